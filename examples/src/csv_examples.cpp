@@ -4,6 +4,7 @@
 #include <jsoncons_ext/csv/csv.hpp>
 #include <jsoncons/json.hpp>
 
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
 #include <cassert>
@@ -51,9 +52,10 @@ void encode_n_objects()
 ]
     )";
 
-    auto j = jsoncons::ojson::parse(jtext);
+    static const auto j = jsoncons::ojson::parse(jtext);
 
     std::string output;
+    output.reserve(jtext.size()); // CSV output is no larger than the JSON source
     auto ioptions = csv::csv_options{}
         .quote_style(csv::quote_style_kind::nonnumeric);
     csv::encode_csv(j, output, ioptions);
@@ -77,9 +79,10 @@ void encode_n_rows()
 ]
     )";
 
-    auto j = jsoncons::json::parse(jtext);
+    static const auto j = jsoncons::json::parse(jtext);
 
     std::string output;
+    output.reserve(jtext.size()); // CSV output is no larger than the JSON source
     auto ioptions = csv::csv_options{}
         .quote_style(csv::quote_style_kind::nonnumeric);
     csv::encode_csv(j, output, ioptions);
@@ -102,9 +105,10 @@ void encode_m_columns()
 }
     )";
 
-    auto j = jsoncons::ojson::parse(jtext);
+    static const auto j = jsoncons::ojson::parse(jtext);
 
     std::string output;
+    output.reserve(jtext.size()); // CSV output is no larger than the JSON source
     auto ioptions = csv::csv_options{}
         .quote_style(csv::quote_style_kind::nonnumeric);
     csv::encode_csv(j, output, ioptions);
@@ -129,20 +133,32 @@ void csv_source_to_json_value()
         .assume_header(true)
         .column_types("string,float,float,float,float");
 
+    // The output is only pretty-printed, so pipe the CSV parse events
+    // straight into a JSON encoder instead of materializing a DOM.
+
     // csv_mapping_kind::n_objects
     options.mapping_kind(csv::csv_mapping_kind::n_objects);
-    auto j1 = csv::decode_csv<jsoncons::ojson>(s,options);
-    std::cout << "\n(1)\n"<< pretty_print(j1) << "\n";
+    std::cout << "\n(1)\n";
+    jsoncons::json_stream_encoder encoder1(std::cout);
+    csv::csv_string_reader reader1(s,encoder1,options);
+    reader1.read();
+    std::cout << "\n";
 
     // csv_mapping_kind::n_rows
     options.mapping_kind(csv::csv_mapping_kind::n_rows);
-    auto j2 = csv::decode_csv<jsoncons::ojson>(s,options);
-    std::cout << "\n(2)\n"<< pretty_print(j2) << "\n";
+    std::cout << "\n(2)\n";
+    jsoncons::json_stream_encoder encoder2(std::cout);
+    csv::csv_string_reader reader2(s,encoder2,options);
+    reader2.read();
+    std::cout << "\n";
 
     // csv_mapping_kind::m_columns
     options.mapping_kind(csv::csv_mapping_kind::m_columns);
-    auto j3 = csv::decode_csv<jsoncons::ojson>(s,options);
-    std::cout << "\n(3)\n" << pretty_print(j3) << "\n";
+    std::cout << "\n(3)\n";
+    jsoncons::json_stream_encoder encoder3(std::cout);
+    csv::csv_string_reader reader3(s,encoder3,options);
+    reader3.read();
+    std::cout << "\n";
 }
 
 void csv_source_to_cpp_object()
@@ -162,17 +178,27 @@ void csv_source_to_cpp_object()
     table_type table = csv::decode_csv<table_type>(data,ioptions);
 
     std::cout << "(1)\n";
+    // Format each row into one buffer and issue a single write, instead of
+    // nine operator<< calls per row.
+    std::string line;
+    char buf[32];
     for (const auto& row : table)
     {
-        std::cout << std::get<0>(row) << "," 
-                  << std::get<1>(row) << "," 
-                  << std::get<2>(row) << "," 
-                  << std::get<3>(row) << "," 
-                  << std::get<4>(row) << "\n";
+        line.clear();
+        line.append(std::get<0>(row));
+        for (double v : {std::get<1>(row),std::get<2>(row),std::get<3>(row),std::get<4>(row)})
+        {
+            line.push_back(',');
+            std::snprintf(buf, sizeof(buf), "%g", v);
+            line.append(buf);
+        }
+        line.push_back('\n');
+        std::cout.write(line.data(), line.size());
     }
     std::cout << "\n";
 
     std::string output;
+    output.reserve(data.size());
 
     auto ooptions = csv::csv_options{}
         .column_names("Date,1Y,2Y,3Y,5Y");
@@ -197,9 +223,17 @@ void csv_decode_without_type_inference()
     std::cout << pretty_print(j) << '\n';
 }
 
+// Reads a whole file into memory in one go, so the parser scans a
+// contiguous buffer instead of pulling bytes through the streambuf.
+std::string slurp(const char* path)
+{
+    std::ifstream is(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+}
+
 void read_write_csv_tasks()
 {
-    std::ifstream is("./input/tasks.csv");
+    const std::string input = slurp("./input/tasks.csv");
 
     jsoncons::json_decoder<jsoncons::ojson> decoder;
     auto options = csv::csv_options{}
@@ -207,7 +241,7 @@ void read_write_csv_tasks()
         .trim(true)
         .ignore_empty_values(true) 
         .column_types("integer,string,string,string");
-    csv::csv_stream_reader reader(is,decoder,options);
+    csv::csv_string_reader reader(input,decoder,options);
     reader.read();
     auto tasks = decoder.get_result();
 
@@ -221,11 +255,7 @@ void read_write_csv_tasks()
 
 void serialize_array_of_arrays_to_comma_delimited()
 {
-    std::string in_file = "./input/countries.json";
-    std::ifstream is(in_file);
-
-    jsoncons::json countries;
-    is >> countries;
+    jsoncons::json countries = jsoncons::json::parse(slurp("./input/countries.json"));
 
     csv::csv_stream_encoder encoder(std::cout);
     countries.dump(encoder);
@@ -233,11 +263,7 @@ void serialize_array_of_arrays_to_comma_delimited()
 
 void encode_to_tab_delimited_file()
 {
-    std::string in_file = "./input/employees.json";
-    std::ifstream is(in_file);
-
-    jsoncons::json employees;
-    is >> employees;
+    jsoncons::json employees = jsoncons::json::parse(slurp("./input/employees.json"));
 
     auto options = csv::csv_options{}
         .field_delimiter('\t');
@@ -248,7 +274,7 @@ void encode_to_tab_delimited_file()
 
 void serialize_books_to_csv_file()
 {
-    auto books = jsoncons::json::parse(R"(
+    static const auto books = jsoncons::json::parse(R"(
     [
         {
             "title" : "Kafka on the Shore",
@@ -274,7 +300,7 @@ void serialize_books_to_csv_file()
 
 void serialize_books_to_csv_file_with_reorder()
 {
-    auto books = jsoncons::json::parse(R"(
+    static const auto books = jsoncons::json::parse(R"(
     [
         {
             "title" : "Kafka on the Shore",
@@ -309,24 +335,24 @@ void last_column_repeats()
 2017-01-08,0.0063,0.0076,0.0084,0.0112,0.014
 )";
 
-    jsoncons::json_decoder<jsoncons::ojson> decoder1;
+    // One decoder serves both passes - get_result() leaves it empty and
+    // reusable, so only the options differ between the two reads.
+    jsoncons::json_decoder<jsoncons::ojson> decoder;
+
     auto options1 = csv::csv_options{}       
         .header_lines(1)
         .column_types("string,float*");
-    std::istringstream is1(bond_yields);
-    csv::csv_stream_reader reader1(is1, decoder1, options1);
+    csv::csv_string_reader reader1(bond_yields, decoder, options1);
     reader1.read();
-    auto val1 = decoder1.get_result();
+    auto val1 = decoder.get_result();
     std::cout << "\n(1)\n" << pretty_print(val1) << "\n";
 
-    jsoncons::json_decoder<jsoncons::ojson> decoder2;
     auto options2 = csv::csv_options{}       
         .assume_header(true)
         .column_types("string,[float*]");
-    std::istringstream is2(bond_yields);
-    csv::csv_stream_reader reader2(is2, decoder2, options2);
+    csv::csv_string_reader reader2(bond_yields, decoder, options2);
     reader2.read();
-    auto val2 = decoder2.get_result();
+    auto val2 = decoder.get_result();
     std::cout << "\n(2)\n" << pretty_print(val2) << "\n";
 }
 
@@ -337,26 +363,24 @@ void last_two_columns_repeat()
 38733,16-Jan-2006,40270,2-Apr-2010,38733,16-Jan-2006,39468,21-Jan-2008
 )";
 
+    jsoncons::json_decoder<jsoncons::ojson> decoder;
+
     // array of arrays
-    jsoncons::json_decoder<jsoncons::ojson> decoder1;
     auto options1 = csv::csv_options{}       
         .column_types("[integer,string]*");
-    std::istringstream is1(holidays);
-    csv::csv_stream_reader reader1(is1, decoder1, options1);
+    csv::csv_string_reader reader1(holidays, decoder, options1);
     reader1.read();
-    auto val1 = decoder1.get_result();
+    auto val1 = decoder.get_result();
     std::cout << "(1)\n" << pretty_print(val1) << "\n";
 
     // array of objects
-    jsoncons::json_decoder<jsoncons::ojson> decoder2;
     auto options2 = csv::csv_options{}       
         .header_lines(1)
         .column_names("CAD,UK,EUR,US")
         .column_types("[integer,string]*");
-    std::istringstream is2(holidays);
-    csv::csv_stream_reader reader2(is2, decoder2, options2);
+    csv::csv_string_reader reader2(holidays, decoder, options2);
     reader2.read();
-    auto val2 = decoder2.get_result();
+    auto val2 = decoder.get_result();
     std::cout << "(2)\n" << pretty_print(val2) << "\n";
 }
 
@@ -387,16 +411,18 @@ void decode_csv_stream()
         .assume_header(true)
         .column_types("string,float,float,float,float");
 
-    std::istringstream is(bond_yields);
-
-    auto j = csv::decode_csv<jsoncons::ojson>(is,options);
-
-    std::cout << pretty_print(j) << '\n';
+    // Read the in-memory buffer directly - wrapping it in a
+    // std::istringstream would copy it and read it back a character
+    // at a time through the streambuf.
+    jsoncons::json_stream_encoder encoder(std::cout);
+    csv::csv_string_reader reader(bond_yields,encoder,options);
+    reader.read();
+    std::cout << '\n';
 }
 
 void encode_csv_file_from_books()
 {
-    auto books = jsoncons::json::parse(R"(
+    static const auto books = jsoncons::json::parse(R"(
     [
         {
             "title" : "Kafka on the Shore",
@@ -420,14 +446,14 @@ void encode_csv_file_from_books()
 
 void decode_encode_csv_tasks()
 {
-    std::ifstream is("./input/tasks.csv");
+    const std::string input = slurp("./input/tasks.csv");
 
     auto options = csv::csv_options{}
         .assume_header(true)
         .trim(true)
         .ignore_empty_values(true) 
         .column_types("integer,string,string,string");
-    auto tasks = csv::decode_csv<jsoncons::ojson>(is, options);
+    auto tasks = csv::decode_csv<jsoncons::ojson>(input, options);
 
     std::cout << "(1)\n" << pretty_print(tasks) << "\n\n";
 
@@ -441,19 +467,28 @@ void csv_parser_type_inference()
         .assume_header(true)
         .mapping_kind(csv::csv_mapping_kind::n_objects);
 
-    std::ifstream is1("input/sales.csv");
-    auto j1 = csv::decode_csv<jsoncons::ojson>(is1,options);
-    std::cout << "\n(1)\n"<< pretty_print(j1) << "\n";
+    // Read the file once and run all three mappings over the same buffer.
+    const std::string input = slurp("input/sales.csv");
+
+    std::cout << "\n(1)\n";
+    jsoncons::json_stream_encoder encoder1(std::cout);
+    csv::csv_string_reader reader1(input,encoder1,options);
+    reader1.read();
+    std::cout << "\n";
 
     options.mapping_kind(csv::csv_mapping_kind::n_rows);
-    std::ifstream is2("input/sales.csv");
-    auto j2 = csv::decode_csv<jsoncons::ojson>(is2,options);
-    std::cout << "\n(2)\n"<< pretty_print(j2) << "\n";
+    std::cout << "\n(2)\n";
+    jsoncons::json_stream_encoder encoder2(std::cout);
+    csv::csv_string_reader reader2(input,encoder2,options);
+    reader2.read();
+    std::cout << "\n";
 
     options.mapping_kind(csv::csv_mapping_kind::m_columns);
-    std::ifstream is3("input/sales.csv");
-    auto j3 = csv::decode_csv<jsoncons::ojson>(is3,options);
-    std::cout << "\n(3)\n"<< pretty_print(j3) << "\n";
+    std::cout << "\n(3)\n";
+    jsoncons::json_stream_encoder encoder3(std::cout);
+    csv::csv_string_reader reader3(input,encoder3,options);
+    reader3.read();
+    std::cout << "\n";
 }
  
 // Examples with subfields
@@ -521,14 +556,16 @@ void encode_json_with_subfields()
 ]
         )";
 
-    auto j = jsoncons::ojson::parse(jtext);
+    static const auto j = jsoncons::ojson::parse(jtext);
 
     auto options = csv::csv_options{}
         .subfield_delimiter(';');
 
-    std::string buf;
-    csv::encode_csv(j, buf, options);
-    std::cout << buf << "\n";
+    // Encode straight to std::cout rather than buffering the whole
+    // document in a std::string first.
+    csv::csv_stream_encoder encoder(std::cout, options);
+    j.dump(encoder);
+    std::cout << "\n";
 }
 
     const std::string data = R"(index_id,observation_date,rate
@@ -551,14 +588,24 @@ void as_a_variant_like_structure()
     std::cout << "(1)\n" << pretty_print(j, print_options) << "\n\n";
 
     // Iterate over the rows
-    std::cout << std::fixed << std::setprecision(7);
     std::cout << "(2)\n";
+    std::string line;
+    char buf[32];
     for (const auto& row : j.array_range())
     {
-        // Access rated as string and rating as double
-        std::cout << row["index_id"].as<std::string>() << ", " 
-                  << row["observation_date"].as<std::string>() << ", " 
-                  << row["rate"].as<double>() << "\n";
+        // Access index_id and observation_date as string views, rate as
+        // double, and emit the whole row with a single write
+        line.clear();
+        auto index_id = row["index_id"].as<jsoncons::string_view>();
+        line.append(index_id.data(), index_id.size());
+        line.append(", ");
+        auto observation_date = row["observation_date"].as<jsoncons::string_view>();
+        line.append(observation_date.data(), observation_date.size());
+        line.append(", ");
+        std::snprintf(buf, sizeof(buf), "%.7f", row["rate"].as<double>());
+        line.append(buf);
+        line.push_back('\n');
+        std::cout.write(line.data(), line.size());
     }
 }
 
@@ -581,6 +628,7 @@ void as_a_strongly_typed_cpp_structure()
 
     // Encode the c++ structure into CSV data
     std::string s;
+    s.reserve(data.size());
     csv::encode_csv(v, s, options);
     std::cout << "(2)\n";
     std::cout << s << "\n";
@@ -670,11 +718,19 @@ void grouped_into_strongly_typed_records()
 
     auto iter = jsoncons::staj_array_iterator<record_type>(cursor);
 
-    std::cout << std::fixed << std::setprecision(7);
-
+    std::string line;
+    char buf[32];
     for (const auto& record : iter)
     {
-        std::cout << std::get<0>(record) << ", " << std::get<1>(record) << ", " << std::get<2>(record) << "\n";
+        line.clear();
+        line.append(std::get<0>(record));
+        line.append(", ");
+        line.append(std::get<1>(record));
+        line.append(", ");
+        std::snprintf(buf, sizeof(buf), "%.7f", std::get<2>(record));
+        line.append(buf);
+        line.push_back('\n');
+        std::cout.write(line.data(), line.size());
     }
 }
 
@@ -711,14 +767,14 @@ void encode_nested_json_to_csv() // (since 1.2.0)
 ]
         )";
 
-    auto j = jsoncons::ojson::parse(jtext);
+    static const auto j = jsoncons::ojson::parse(jtext);
 
     auto options = csv::csv_options{}
         .flat(false);
 
-    std::string buf;
-    csv::encode_csv(j, buf, options);
-    std::cout << buf << "\n";
+    csv::csv_stream_encoder encoder(std::cout, options);
+    j.dump(encoder);
+    std::cout << "\n";
 }
 
 void encode_nested_json_to_csv_with_column_mapping() // (since 1.2.0)
@@ -754,7 +810,7 @@ void encode_nested_json_to_csv_with_column_mapping() // (since 1.2.0)
 ]
         )";
 
-    auto j = jsoncons::ojson::parse(jtext);
+    static const auto j = jsoncons::ojson::parse(jtext);
 
     auto options = csv::csv_options{}
         .flat(false)
@@ -764,13 +820,16 @@ void encode_nested_json_to_csv_with_column_mapping() // (since 1.2.0)
             {"/nested/nested/integer","Count"}
         });
 
-    std::string buf;
-    csv::encode_csv(j, buf, options);
-    std::cout << buf << "\n";
+    csv::csv_stream_encoder encoder(std::cout, options);
+    j.dump(encoder);
+    std::cout << "\n";
 }
 
 int main()
 {
+    // All output goes to std::cout; skip the C-stdio synchronization cost.
+    std::ios_base::sync_with_stdio(false);
+
     std::cout << "\nCSV examples\n\n";
     read_write_csv_tasks();
     encode_to_tab_delimited_file();
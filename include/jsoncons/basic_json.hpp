@@ -1536,6 +1536,25 @@ namespace jsoncons {
             }
         }
 
+        // Returns a view of the character data if this is a string, otherwise
+        // a view whose data() is nullptr.
+        string_view_type string_view_or_null() const noexcept
+        {
+            switch (storage_kind())
+            {
+                case json_storage_kind::short_str:
+                    return string_view_type(cast<short_string_storage>().data(),cast<short_string_storage>().length());
+                case json_storage_kind::long_str:
+                    return string_view_type(cast<long_string_storage>().data(),cast<long_string_storage>().length());
+                case json_storage_kind::json_const_ref:
+                    return cast<json_const_reference_storage>().value().string_view_or_null();
+                case json_storage_kind::json_ref:
+                    return cast<json_reference_storage>().value().string_view_or_null();
+                default:
+                   return string_view_type();
+            }
+        }
+
         template <typename T,typename Alloc, typename TempAlloc>
         typename std::enable_if<ext_traits::is_basic_byte_string<T>::value,conversion_result<T>>::type
         try_as_byte_string(const allocator_set<Alloc,TempAlloc>& aset) const
@@ -47,6 +47,62 @@ namespace detail {
         return cp >= 0x80;
     }
 
+    // Classification used by the narrow-character fast path below:
+    // 0 = copies through verbatim, 1 = always escaped, 2 = escaped only
+    // when escape_solidus is set.
+    inline
+    const uint8_t* escape_class_table()
+    {
+        static const uint8_t tbl[256] = {
+            1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, // 0x00-0x0F
+            1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, // 0x10-0x1F
+            0,0,1,0,0,0,0,0, 0,0,0,0,0,0,0,2, // 0x20-0x2F  '"' 0x22, '/' 0x2F
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, // 0x30-0x3F
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, // 0x40-0x4F
+            0,0,0,0,0,0,0,0, 0,0,0,0,1,0,0,0, // 0x50-0x5F  '\\' 0x5C
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, // 0x60-0x6F
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,1, // 0x70-0x7F  DEL 0x7F
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, // 0x80-
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0
+        };
+        return tbl;
+    }
+
+    // True if c passes through the JSON string encoder verbatim, so a
+    // run of such characters can be appended to the sink in one piece.
+    template <typename CharT>
+    bool is_clean_character(CharT c, bool escape_solidus)
+    {
+        switch (c)
+        {
+            case '\\':
+            case '"':
+            case '\b':
+            case '\f':
+            case '\n':
+            case '\r':
+            case '\t':
+                return false;
+            case '/':
+                return !escape_solidus;
+            default:
+                return !is_control_character(c);
+        }
+    }
+
+    inline
+    bool is_clean_character(char c, bool escape_solidus)
+    {
+        const uint8_t cls = escape_class_table()[static_cast<unsigned char>(c)];
+        return cls == 0 || (cls == 2 && !escape_solidus);
+    }
+
     template <typename CharT,typename Sink>
     std::size_t escape_string(const CharT* s, std::size_t length,
                          bool escape_all_non_ascii, bool escape_solidus,
@@ -57,6 +113,25 @@ namespace detail {
         const CharT* end = s + length;
         for (const CharT* it = begin; it != end; ++it)
         {
+            if (!escape_all_non_ascii)
+            {
+                // Bulk-copy the span up to the next character that
+                // needs escaping instead of pushing a byte at a time.
+                const CharT* span = it;
+                while (it != end && is_clean_character(*it, escape_solidus))
+                {
+                    ++it;
+                }
+                if (it != span)
+                {
+                    sink.append(span, static_cast<std::size_t>(it - span));
+                    count += static_cast<std::size_t>(it - span);
+                }
+                if (it == end)
+                {
+                    break;
+                }
+            }
             CharT c = *it;
             switch (c)
             {
@@ -726,6 +726,104 @@ struct decode_traits<T,
     }
 };
 
+// std::tuple
+
+namespace detail {
+
+    template <std::size_t Pos,std::size_t Size,typename Tuple>
+    struct tuple_decode_helper
+    {
+        using element_type = typename std::tuple_element<Size-Pos, Tuple>::type;
+        using next = tuple_decode_helper<Pos-1, Size, Tuple>;
+
+        template <typename CharT,typename Alloc,typename TempAlloc>
+        static void try_decode(bool from_object, Tuple& tuple, const allocator_set<Alloc,TempAlloc>& aset,
+            basic_staj_cursor<CharT>& cursor, std::error_code& ec)
+        {
+            if (from_object)
+            {
+                // Positional decode of an object-shaped row: skip the key.
+                if (cursor.current().event_type() != staj_event_type::key)
+                {
+                    ec = conv_errc::conversion_failed;
+                    return;
+                }
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+            }
+            auto r = decode_traits<element_type>::try_decode(aset, cursor);
+            if (JSONCONS_UNLIKELY(!r))
+            {
+                ec = r.error().code();
+                return;
+            }
+            std::get<Size-Pos>(tuple) = std::move(*r);
+            cursor.next(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            next::try_decode(from_object, tuple, aset, cursor, ec);
+        }
+    };
+
+    template <std::size_t Size,typename Tuple>
+    struct tuple_decode_helper<0,Size,Tuple>
+    {
+        template <typename CharT,typename Alloc,typename TempAlloc>
+        static void try_decode(bool, Tuple&, const allocator_set<Alloc,TempAlloc>&,
+            basic_staj_cursor<CharT>&, std::error_code&)
+        {
+        }
+    };
+
+} // namespace detail
+
+// Decodes each tuple element straight off the cursor, unrolled over the
+// element types at compile time, instead of materializing a basic_json
+// array per row and converting it.
+template <typename... E>
+struct decode_traits<std::tuple<E...>>
+{
+    using value_type = std::tuple<E...>;
+    using result_type = read_result<value_type>;
+
+    template <typename CharT,typename Alloc,typename TempAlloc>
+    static result_type try_decode(const allocator_set<Alloc,TempAlloc>& aset, basic_staj_cursor<CharT>& cursor)
+    {
+        std::error_code ec;
+
+        // A tuple may be decoded positionally from an array-shaped row or
+        // from an object-shaped row (e.g. CSV n_objects mapping).
+        bool from_object = cursor.current().event_type() == staj_event_type::begin_object;
+        if (!from_object && cursor.current().event_type() != staj_event_type::begin_array)
+        {
+            return result_type(jsoncons::unexpect, conv_errc::not_array, cursor.line(), cursor.column());
+        }
+        cursor.next(ec); // skip past begin_array/begin_object
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return result_type(jsoncons::unexpect, ec, cursor.line(), cursor.column());
+        }
+
+        value_type val;
+        detail::tuple_decode_helper<sizeof...(E), sizeof...(E), value_type>::try_decode(from_object, val, aset, cursor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return result_type(jsoncons::unexpect, ec, cursor.line(), cursor.column());
+        }
+
+        if (cursor.current().event_type() != (from_object ? staj_event_type::end_object : staj_event_type::end_array))
+        {
+            return result_type(jsoncons::unexpect, conv_errc::not_array, cursor.line(), cursor.column());
+        }
+        return result_type{std::move(val)};
+    }
+};
+
 } // namespace reflect
 } // namespace jsoncons
 
@@ -89,6 +89,73 @@ namespace reflect {
 
 namespace detail {
 
+// Constructs an error result out of line so that the try_as fast paths
+// stay small when inlined into callers.
+template <typename R>
+JSONCONS_NOINLINE
+R conv_error(conv_errc ec)
+{
+    return R(jsoncons::unexpect, ec);
+}
+
+template <typename R>
+JSONCONS_NOINLINE
+R conv_error(std::error_code ec, const std::string& message_arg)
+{
+    return R(jsoncons::unexpect, ec, message_arg);
+}
+
+// Detects map keys that view characters of the Json's char_type, so they
+// can become object keys without a Json intermediary.
+template <typename Json,typename KeyT,typename Enable=void>
+struct is_json_string_view_key : std::false_type {};
+
+template <typename Json,typename KeyT>
+struct is_json_string_view_key<Json,KeyT,
+    typename std::enable_if<ext_traits::is_string_view<KeyT>::value &&
+        std::is_same<typename KeyT::value_type,typename Json::char_type>::value>::type>
+    : std::true_type {};
+
+template <typename T>
+typename std::enable_if<ext_traits::has_reserve<T>::value>::type
+maybe_reserve(T& v, std::size_t size)
+{
+    v.reserve(size);
+}
+
+template <typename T>
+typename std::enable_if<!ext_traits::has_reserve<T>::value>::type
+maybe_reserve(T&, std::size_t)
+{
+}
+
+// Parses a decimal string that fits in int64_t, so epoch strings can
+// skip bigint arithmetic. dec_to_integer detects overflow exactly, so
+// every in-range value (including 19-digit nanosecond timestamps) takes
+// this path; callers handle out-of-range or malformed input with the
+// general path.
+template <typename CharT>
+bool try_dec_to_int64(const CharT* s, std::size_t length, int64_t& n)
+{
+    auto result = jsoncons::utility::dec_to_integer(s, length, n);
+    return static_cast<bool>(result);
+}
+
+// Shared by the array specializations' is() members, so the scan is
+// instantiated once per (Json,value_type) rather than once per container.
+template <typename Json,typename VT>
+bool array_elements_match(const Json& j) noexcept
+{
+    for (const auto& e : j.array_range())
+    {
+        if (JSONCONS_UNLIKELY(!e.template is<VT>()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename Json,typename T>
 using
 traits_can_convert_t = decltype(json_conv_traits<Json,T>::can_convert(Json()));
@@ -131,11 +198,62 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
     struct is_compatible_array_type : std::false_type {};
 
     template <typename Json,typename T>
-    struct is_compatible_array_type<Json,T, 
+    struct is_compatible_array_type<Json,T,
         typename std::enable_if<!std::is_same<T,typename Json::array>::value &&
-        ext_traits::is_array_like<T>::value 
+        ext_traits::is_array_like<T>::value
     >::type> : std::true_type {};
 
+    // Upper bound, in target code units, on transcoding count source
+    // code units between UTF encodings. Widening never needs more units
+    // than the source has; narrowing expands at most 3x (UTF-16 to
+    // UTF-8), 4x (UTF-32 to UTF-8) or 2x (UTF-32 to UTF-16).
+    template <typename From,typename To>
+    struct transcode_expansion
+    {
+        static constexpr std::size_t value =
+            (sizeof(From) == 2 && sizeof(To) == 1) ? 3 :
+            (sizeof(From) == 4 && sizeof(To) == 1) ? 4 :
+            (sizeof(From) == 4 && sizeof(To) == 2) ? 2 : 1;
+    };
+
+    // Common implementation for bool and the std::vector<bool> proxy
+    // reference types, which all convert through a plain bool.
+    template <typename Json>
+    struct bool_conv_traits_base
+    {
+        using result_type = conversion_result<bool>;
+
+        static bool is(const Json& j) noexcept
+        {
+            return j.is_bool();
+        }
+
+        template<typename Alloc,typename TempAlloc>
+        static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
+        {
+            return result_type{j.as_bool()};
+        }
+
+        template <typename Alloc, typename TempAlloc>
+        static Json to_json(const allocator_set<Alloc,TempAlloc>&, bool val)
+        {
+            return Json(val, semantic_tag::none);
+        }
+    };
+
+    // Builds a json array from a range. Shared by the array-family
+    // to_json implementations so each container type instantiates the
+    // body once per element type rather than once per specialization.
+    // The json_array_arg range constructor sizes the array storage once
+    // and constructs the elements in place, so there is no per-element
+    // capacity check.
+    template <typename Json,typename Container,typename Alloc,typename TempAlloc>
+    Json json_array_from_range(const allocator_set<Alloc,TempAlloc>& aset, const Container& val)
+    {
+        return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg,
+            std::begin(val), std::end(val), semantic_tag::none);
+    }
+
 } // namespace detail
 
     // is_json_conv_traits_specialized
@@ -251,12 +369,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template<typename Alloc,typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
         {
-            auto result = j.try_as_double();
-            if (JSONCONS_UNLIKELY(!result))
-            {
-                return result_type(jsoncons::unexpect, result.error().code());
-            }
-            return result_type(static_cast<T>(*result));
+            return try_as_(typename std::is_same<T,double>::type(), j);
         }
 
         template <typename Alloc, typename TempAlloc>
@@ -264,6 +377,25 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         {
             return Json(val, semantic_tag::none);
         }
+
+    private:
+        // Passes the double result through unwrapped, saving a
+        // conversion_result re-construction per call on the hot
+        // element-by-element array paths.
+        static result_type try_as_(std::true_type, const Json& j)
+        {
+            return j.try_as_double();
+        }
+
+        static result_type try_as_(std::false_type, const Json& j)
+        {
+            auto result = j.try_as_double();
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                return result_type(jsoncons::unexpect, result.error().code());
+            }
+            return result_type(static_cast<T>(*result));
+        }
     };
 
     template <typename Json>
@@ -334,7 +466,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template<typename Alloc,typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
         {
-            if (!j.is_null())
+            if (JSONCONS_UNLIKELY(!j.is_null()))
             {
                 return result_type{jsoncons::unexpect, conv_errc::not_jsoncons_null_type};
             }
@@ -349,72 +481,21 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
     };
 
     template <typename Json>
-    struct json_conv_traits<Json, bool>
+    struct json_conv_traits<Json, bool> : detail::bool_conv_traits_base<Json>
     {
-        using result_type = conversion_result<bool>;
-
-        static bool is(const Json& j) noexcept
-        {
-            return j.is_bool();
-        }
-        template<typename Alloc,typename TempAlloc>
-        static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
-        {
-            return result_type{j.as_bool()};
-        }
-
-        template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>&, bool val)
-        {
-            return Json(val, semantic_tag::none);
-        }
     };
 
     template <typename Json,typename T>
-    struct json_conv_traits<Json, T,typename std::enable_if<std::is_same<T, 
+    struct json_conv_traits<Json, T,typename std::enable_if<std::is_same<T,
         std::conditional<!std::is_same<bool,std::vector<bool>::const_reference>::value,
                          std::vector<bool>::const_reference,
-                         void>::type>::value>::type>
+                         void>::type>::value>::type> : detail::bool_conv_traits_base<Json>
     {
-        using result_type = conversion_result<bool>;
-
-        static bool is(const Json& j) noexcept
-        {
-            return j.is_bool();
-        }
-        template<typename Alloc,typename TempAlloc>
-        static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
-        {
-            return result_type{j.as_bool()};
-        }
-
-        template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>&, bool val)
-        {
-            return Json(val, semantic_tag::none);
-        }
     };
 
     template <typename Json>
-    struct json_conv_traits<Json, std::vector<bool>::reference>
+    struct json_conv_traits<Json, std::vector<bool>::reference> : detail::bool_conv_traits_base<Json>
     {
-        using result_type = conversion_result<bool>;
-
-        static bool is(const Json& j) noexcept
-        {
-            return j.is_bool();
-        }
-        template<typename Alloc,typename TempAlloc>
-        static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
-        {
-            return result_type{j.as_bool()};
-        }
-
-        template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>&, bool val)
-        {
-            return Json(val, semantic_tag::none);
-        }
     };
 
     template <typename Json,typename T>
@@ -461,12 +542,13 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template<typename Alloc,typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (!j.is_string())
+            if (JSONCONS_UNLIKELY(!j.is_string()))
             {
                 return result_type{jsoncons::unexpect, conv_errc::not_string};
             }
             auto sv = j.as_string_view();
             T val = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
+            val.reserve(sv.size() * detail::transcode_expansion<typename Json::char_type,typename T::value_type>::value);
             unicode_traits::convert(sv.data(), sv.size(), val);
             return result_type(std::move(val));
         }
@@ -476,6 +558,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         {
             using temp_alloc_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<char_type>;
             std::basic_string<char_type,std::char_traits<char_type>,temp_alloc_type> s(aset.get_temp_allocator());
+            s.reserve(val.size() * detail::transcode_expansion<typename T::value_type,char_type>::value);
             unicode_traits::convert(val.data(), val.size(), s);
             return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), s, semantic_tag::none);
         }
@@ -497,8 +580,12 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template<typename Alloc,typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
         {
-            auto result = j.try_as_string_view();
-            return result ? result_type(in_place, result.value().data(), result.value().size()) : result_type(unexpect, conv_errc::not_string); 
+            auto sv = j.string_view_or_null();
+            if (JSONCONS_UNLIKELY(sv.data() == nullptr))
+            {
+                return detail::conv_error<result_type>(conv_errc::not_string);
+            }
+            return result_type(in_place, sv.data(), sv.size());
         }
 
         template <typename Alloc, typename TempAlloc>
@@ -522,19 +609,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (const auto& e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && detail::array_elements_match<Json,value_type>(j);
         }
 
         // array back insertable non-byte container
@@ -543,9 +618,9 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         static typename std::enable_if<!ext_traits::is_byte<typename Container::value_type>::value,result_type>::type
         try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (!j.is_array())
+            if (JSONCONS_UNLIKELY(!j.is_array()))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                return detail::conv_error<result_type>(conv_errc::not_vector);
             }
             T result{jsoncons::make_obj_using_allocator<T>(aset.get_allocator())};
             visit_reserve_(typename std::integral_constant<bool, ext_traits::has_reserve<T>::value>::type(),result,j.size());
@@ -554,7 +629,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 auto res = item.template try_as<value_type>(aset);
                 if (JSONCONS_UNLIKELY(!res))
                 {
-                    return result_type(jsoncons::unexpect, res.error().code(), res.error().message_arg());
+                    return detail::conv_error<result_type>(res.error().code(), res.error().message_arg());
                 }
                 result.push_back(std::move(*res));
             }
@@ -578,7 +653,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                     auto res = item.template try_as<value_type>(aset);
                     if (JSONCONS_UNLIKELY(!res))
                     {
-                        return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                        return detail::conv_error<result_type>(conv_errc::not_vector);
                     }
                     result.push_back(std::move(*res));
                 }
@@ -598,13 +673,13 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 auto r = string_to_bytes(sv.begin(), sv.end(), j.tag(), v);
                 if (JSONCONS_UNLIKELY(r.ec != conv_errc{}))
                 {
-                    return result_type(jsoncons::unexpect, conv_errc::not_byte_string);
+                    return detail::conv_error<result_type>(conv_errc::not_byte_string);
                 }
                 return result_type(std::move(v));
             }
             else
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                return detail::conv_error<result_type>(conv_errc::not_vector);
             }
         }
 
@@ -612,16 +687,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         static typename std::enable_if<!ext_traits::is_std_byte<typename Container::value_type>::value,Json>::type
         to_json(const allocator_set<Alloc,TempAlloc>& aset, const T& val)
         {
-            auto j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg);
-            auto first = std::begin(val);
-            auto last = std::end(val);
-            std::size_t size = std::distance(first, last);
-            j.reserve(size);
-            for (auto it = first; it != last; ++it)
-            {
-                j.push_back(*it);
-            }
-            return j;
+            return detail::json_array_from_range<Json>(aset, val);
         }
 
         template <typename Alloc,typename TempAlloc,typename Container = T>
@@ -655,19 +721,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (const auto& e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && detail::array_elements_match<Json,value_type>(j);
         }
 
         template <typename Alloc, typename TempAlloc>
@@ -681,7 +735,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                     auto res = item.template try_as<value_type>(aset);
                     if (JSONCONS_UNLIKELY(!res))
                     {
-                        return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                        return detail::conv_error<result_type>(conv_errc::not_vector);
                     }
                     result.insert(std::move(*res));
                 }
@@ -690,23 +744,14 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
             }
             else 
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                return detail::conv_error<result_type>(conv_errc::not_vector);
             }
         }
 
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const T& val)
         {
-            auto j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg);
-            auto first = std::begin(val);
-            auto last = std::end(val);
-            std::size_t size = std::distance(first, last);
-            j.reserve(size);
-            for (auto it = first; it != last; ++it)
-            {
-                j.push_back(*it);
-            }
-            return j;
+            return detail::json_array_from_range<Json>(aset, val);
         }
     };
 
@@ -725,19 +770,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (const auto& e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && detail::array_elements_match<Json,value_type>(j);
         }
 
         template <typename Alloc, typename TempAlloc>
@@ -745,41 +778,39 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         {
             if (j.is_array())
             {
-                T result = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
-
-                auto it = j.array_range().rbegin();
-                auto end = j.array_range().rend();
-                for (; it != end; ++it)
+                // Convert forward into contiguous scratch, then push_front
+                // in reverse, rather than walking the array backwards.
+                using temp_alloc_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<value_type>;
+                std::vector<value_type,temp_alloc_type> tmp(aset.get_temp_allocator());
+                tmp.reserve(j.size());
+                for (const auto& item : j.array_range())
                 {
-                    auto res = (*it).template try_as<value_type>(aset);
+                    auto res = item.template try_as<value_type>(aset);
                     if (JSONCONS_UNLIKELY(!res))
                     {
-                        return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                        return detail::conv_error<result_type>(conv_errc::not_vector);
                     }
-                    result.push_front(std::move(*res));
+                    tmp.push_back(std::move(*res));
+                }
+
+                T result = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
+                for (auto it = tmp.rbegin(); it != tmp.rend(); ++it)
+                {
+                    result.push_front(std::move(*it));
                 }
 
                 return result_type(std::move(result));
             }
             else 
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_vector);
+                return detail::conv_error<result_type>(conv_errc::not_vector);
             }
         }
 
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const T& val)
         {
-            auto j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg);
-            auto first = std::begin(val);
-            auto last = std::end(val);
-            std::size_t size = std::distance(first, last);
-            j.reserve(size);
-            for (auto it = first; it != last; ++it)
-            {
-                j.push_back(*it);
-            }
-            return j;
+            return detail::json_array_from_range<Json>(aset, val);
         }
     };
 
@@ -794,35 +825,39 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array() && j.size() == N;
-            if (result)
-            {
-                for (const auto& e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && j.size() == N && detail::array_elements_match<Json,value_type>(j);
         }
 
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
             std::array<E, N> buff;
-            if (j.size() != N)
+            if (JSONCONS_UNLIKELY(j.size() != N))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_array);
+                return detail::conv_error<result_type>(conv_errc::not_array);
+            }
+            if (j.is_array())
+            {
+                // Walk the elements once instead of re-resolving the array
+                // storage with j[i] on every index.
+                std::size_t i = 0;
+                for (const auto& item : j.array_range())
+                {
+                    auto res = item.template try_as<E>(aset);
+                    if (JSONCONS_UNLIKELY(!res))
+                    {
+                        return detail::conv_error<result_type>(conv_errc::not_array);
+                    }
+                    buff[i++] = std::move(*res);
+                }
+                return result_type(std::move(buff));
             }
             for (std::size_t i = 0; i < N; i++)
             {
                 auto res = j[i].template try_as<E>(aset);
                 if (JSONCONS_UNLIKELY(!res))
                 {
-                    return result_type(jsoncons::unexpect, conv_errc::not_array);
+                    return detail::conv_error<result_type>(conv_errc::not_array);
                 }
                 buff[i] = std::move(*res);
             }
@@ -832,13 +867,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::array<E, N>& val)
         {
-            auto j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg);
-            j.reserve(N);
-            for (auto it = val.begin(); it != val.end(); ++it)
-            {
-                j.push_back(*it);
-            }
-            return j;
+            return detail::json_array_from_range<Json>(aset, val);
         }
     };
 
@@ -858,13 +887,13 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            if (!j.is_object())
+            if (JSONCONS_UNLIKELY(!j.is_object()))
             {
                 return false;
             }
             for (const auto& member : j.object_range())
             {
-                if (!member.value().template is<mapped_type>())
+                if (JSONCONS_UNLIKELY(!member.value().template is<mapped_type>()))
                 {
                     return false;
                 }
@@ -875,19 +904,20 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (!j.is_object())
+            if (JSONCONS_UNLIKELY(!j.is_object()))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_map);
+                return detail::conv_error<result_type>(conv_errc::not_map);
             }
             auto val = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
+            detail::maybe_reserve(val, j.size());
             for (const auto& item : j.object_range())
             {
                 auto key = jsoncons::make_obj_using_allocator<key_type>(aset.get_allocator(), 
                     item.key().data(), item.key().size());
                 auto r2 = item.value().template try_as<mapped_type>(aset);
-                if (!r2)
+                if (JSONCONS_UNLIKELY(!r2))
                 {
-                    return result_type(jsoncons::unexpect, r2.error().code(), r2.error().message_arg());
+                    return detail::conv_error<result_type>(r2.error().code(), r2.error().message_arg());
                 }
                 val.emplace(std::move(key), std::move(*r2));
             }
@@ -924,16 +954,16 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept 
         {
-            if (!j.is_object())
+            if (JSONCONS_UNLIKELY(!j.is_object()))
                 return false;
             for (const auto& item : j.object_range())
             {
                 Json k(item.key());
-                if (!k.template is<key_type>())
+                if (JSONCONS_UNLIKELY(!k.template is<key_type>()))
                 {
                     return false;
                 }
-                if (!item.value().template is<mapped_type>())
+                if (JSONCONS_UNLIKELY(!item.value().template is<mapped_type>()))
                 {
                     return false;
                 }
@@ -944,16 +974,16 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j) 
         {
-            if (!j.is_object())
+            if (JSONCONS_UNLIKELY(!j.is_object()))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_map);
+                return detail::conv_error<result_type>(conv_errc::not_map);
             }
 
             auto val = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
+            detail::maybe_reserve(val, j.size());
             for (const auto& item : j.object_range())
             {
-                auto k = jsoncons::make_obj_using_allocator<Json>(j.get_allocator(), item.key());
-                auto r1 = k.template try_as<key_type>(aset);
+                auto r1 = try_as_key_(aset, j, item.key());
                 if (!r1)
                 {
                     return result_type(jsoncons::unexpect, r1.error());
@@ -970,10 +1000,27 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         }
 
         template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const T& val) 
+        static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const T& val)
         {
             Json j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none);
             j.reserve(val.size());
+            to_json_(typename detail::is_json_string_view_key<Json,key_type>::type(), aset, val, j);
+            return j;
+        }
+
+    private:
+        template <typename Alloc, typename TempAlloc>
+        static void to_json_(std::true_type, const allocator_set<Alloc,TempAlloc>& aset, const T& val, Json& j)
+        {
+            for (const auto& item : val)
+            {
+                j.try_emplace(jsoncons::make_obj_using_allocator<typename Json::key_type>(aset.get_allocator(), item.first.data(), item.first.size()), item.second);
+            }
+        }
+
+        template <typename Alloc, typename TempAlloc>
+        static void to_json_(std::false_type, const allocator_set<Alloc,TempAlloc>& aset, const T& val, Json& j)
+        {
             for (const auto& item : val)
             {
                 auto temp = json_conv_traits<Json, key_type>::to_json(aset, item.first);
@@ -989,104 +1036,108 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                     j.try_emplace(std::move(key), item.second);
                 }
             }
-            return j;
         }
-    };
 
-    namespace tuple_detail
-    {
-        template<size_t Pos, std::size_t Size,typename Json,typename Tuple>
-        struct json_tuple_helper
+        // Integer keys parse straight from the member name, skipping the
+        // temporary Json the general path needs for trait dispatch.
+        template <typename Alloc, typename TempAlloc, typename KeyT = key_type>
+        static typename std::enable_if<ext_traits::is_integer<KeyT>::value,conversion_result<KeyT>>::type
+        try_as_key_(const allocator_set<Alloc,TempAlloc>&, const Json&, const typename Json::string_view_type& key)
         {
-            using element_type = typename std::tuple_element<Size-Pos, Tuple>::type;
-            using next = json_tuple_helper<Pos-1, Size, Json, Tuple>;
-            
-            static bool is(const Json& j) noexcept
+            KeyT kval;
+            auto r = jsoncons::utility::to_integer<KeyT>(key.data(), key.size(), kval);
+            if (JSONCONS_UNLIKELY(!r))
             {
-                if (j[Size-Pos].template is<element_type>())
-                {
-                    return next::is(j);
-                }
-                else
-                {
-                    return false;
-                }
+                return conversion_result<KeyT>(jsoncons::unexpect, conv_errc::not_integer);
             }
+            return conversion_result<KeyT>(kval);
+        }
 
-            template <typename Alloc,typename TempAlloc>
-            static void try_as(Tuple& tuple, const allocator_set<Alloc,TempAlloc>& aset, const Json& j, std::error_code& ec)
-            {
-                auto res = j[Size-Pos].template try_as<element_type>(aset);
-                if (!res)
-                {
-                    ec = res.error().code();
-                    return;
-                }
-                std::get<Size-Pos>(tuple) = *res;
-                next::try_as(tuple, aset, j, ec);
-            }
+        template <typename Alloc, typename TempAlloc, typename KeyT = key_type>
+        static typename std::enable_if<!ext_traits::is_integer<KeyT>::value,conversion_result<KeyT>>::type
+        try_as_key_(const allocator_set<Alloc,TempAlloc>& aset, const Json& j, const typename Json::string_view_type& key)
+        {
+            auto k = jsoncons::make_obj_using_allocator<Json>(j.get_allocator(), key);
+            return k.template try_as<KeyT>(aset);
+        }
+    };
 
-            template <typename Alloc, typename TempAlloc>
-            static void to_json(const allocator_set<Alloc,TempAlloc>& aset, const Tuple& tuple, Json& j)
-            {
-                j.push_back(json_conv_traits<Json, element_type>::to_json(aset, std::get<Size-Pos>(tuple)));
-                next::to_json(aset, tuple, j);
-            }
-        };
+    template <typename Json,typename... E>
+    struct json_conv_traits<Json, std::tuple<E...>>
+    {
+    private:
+        using tuple_type = std::tuple<E...>;
 
-        template<size_t Size,typename Json,typename Tuple>
-        struct json_tuple_helper<0, Size, Json, Tuple>
+        template <std::size_t I>
+        using element = typename std::tuple_element<I,tuple_type>::type;
+
+        template <std::size_t... I>
+        static bool is_(const Json& j, ext_traits::index_sequence<I...>) noexcept
         {
-            static bool is(const Json&) noexcept
-            {
-                return true;
-            }
+            bool result = true;
+            const bool checks[] = {true, (result = result && j[I].template is<element<I>>())...};
+            (void)checks;
+            return result;
+        }
 
-            template <typename Alloc, typename TempAlloc>
-            static void try_as(Tuple&, const allocator_set<Alloc,TempAlloc>&, const Json&, std::error_code&)
+        template <std::size_t I,typename Alloc,typename TempAlloc>
+        static bool try_as_element_(tuple_type& tuple, const allocator_set<Alloc,TempAlloc>& aset,
+            const Json& j, std::error_code& ec)
+        {
+            auto res = j[I].template try_as<element<I>>(aset);
+            if (JSONCONS_UNLIKELY(!res))
             {
+                ec = res.error().code();
+                return false;
             }
+            std::get<I>(tuple) = std::move(*res);
+            return true;
+        }
 
-            template <typename Alloc, typename TempAlloc>
-            static void to_json(const allocator_set<Alloc,TempAlloc>&, const Tuple&, Json&)
-            {
-            }
-        };
-    } // namespace tuple_detail
+        template <std::size_t... I,typename Alloc,typename TempAlloc>
+        static void try_as_(tuple_type& tuple, const allocator_set<Alloc,TempAlloc>& aset,
+            const Json& j, std::error_code& ec, ext_traits::index_sequence<I...>)
+        {
+            const bool steps[] = {true, (!ec && try_as_element_<I>(tuple, aset, j, ec))...};
+            (void)steps;
+        }
 
-    template <typename Json,typename... E>
-    struct json_conv_traits<Json, std::tuple<E...>>
-    {
-    private:
-        using helper = tuple_detail::json_tuple_helper<sizeof...(E), sizeof...(E), Json, std::tuple<E...>>;
+        template <std::size_t... I,typename Alloc,typename TempAlloc>
+        static void to_json_(const allocator_set<Alloc,TempAlloc>& aset, const tuple_type& val, Json& j,
+            ext_traits::index_sequence<I...>)
+        {
+            const int expander[] = {0, (j.push_back(json_conv_traits<Json,element<I>>::to_json(aset, std::get<I>(val))), 0)...};
+            (void)expander;
+        }
 
     public:
-        using result_type = conversion_result<std::tuple<E...>>;
+        using result_type = conversion_result<tuple_type>;
 
         static bool is(const Json& j) noexcept
         {
-            return helper::is(j);
+            return j.is_array() && j.size() == sizeof...(E) &&
+                is_(j, ext_traits::make_index_sequence<sizeof...(E)>());
         }
-        
+
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
             std::error_code ec;
-            std::tuple<E...> val;
-            helper::try_as(val, aset, j, ec);
+            tuple_type val;
+            try_as_(val, aset, j, ec, ext_traits::make_index_sequence<sizeof...(E)>());
             if (ec)
             {
                 return result_type(jsoncons::unexpect, ec);
             }
             return result_type(std::move(val));
         }
-         
+
         template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::tuple<E...>& val)
+        static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const tuple_type& val)
         {
             Json j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg, semantic_tag::none);
             j.reserve(sizeof...(E));
-            helper::to_json(aset, val, j);
+            to_json_(aset, val, j, ext_traits::make_index_sequence<sizeof...(E)>());
             return j;
         }
     };
@@ -1105,21 +1156,21 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (!j.is_array() || j.size() != 2)
+            if (JSONCONS_UNLIKELY(!j.is_array() || j.size() != 2))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_pair);
+                return detail::conv_error<result_type>(conv_errc::not_pair);
             }
             auto res1 = j[0].template try_as<T1>(aset);
-            if (!res1)
+            if (JSONCONS_UNLIKELY(!res1))
             {
                 return result_type(jsoncons::unexpect, res1.error().code());
             }
             auto res2 = j[1].template try_as<T2>(aset);
-            if (!res2)
+            if (JSONCONS_UNLIKELY(!res2))
             {
                 return result_type(jsoncons::unexpect, res2.error().code());
             }
-            return result_type(std::make_pair<T1,T2>(std::move(*res1), std::move(*res2)));
+            return result_type(jsoncons::in_place, std::move(*res1), std::move(*res2));
         }
         
         template <typename Alloc, typename TempAlloc>
@@ -1179,7 +1230,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 return result_type(std::shared_ptr<ValueType>(nullptr));
             }
             auto r = j.template try_as<ValueType>(aset);
-            if (!r)
+            if (JSONCONS_UNLIKELY(!r))
             {
                 return result_type(jsoncons::unexpect, r.error());
             }
@@ -1189,14 +1240,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::shared_ptr<ValueType>& ptr)
         {
-            if (ptr.get() != nullptr) 
-            {
-                return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *ptr);
-            }
-            else 
-            {
-                return Json::null();
-            }
+            return ptr ? jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *ptr) : Json::null();
         }
     };
 
@@ -1221,7 +1265,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 return result_type(std::unique_ptr<ValueType>(nullptr));
             }
             auto r = j.template try_as<ValueType>(aset);
-            if (!r)
+            if (JSONCONS_UNLIKELY(!r))
             {
                 return result_type(jsoncons::unexpect, r.error());
             }
@@ -1231,14 +1275,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::unique_ptr<ValueType>& ptr)
         {
-            if (ptr.get() != nullptr) 
-            {
-                return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *ptr, semantic_tag::none);
-            }
-            else 
-            {
-                return Json::null();
-            }
+            return ptr ? jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *ptr, semantic_tag::none) : Json::null();
         }
     };
 
@@ -1262,7 +1299,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 return result_type(jsoncons::optional<T>());
             }
             auto r = j.template try_as<T>(aset);
-            if (!r)
+            if (JSONCONS_UNLIKELY(!r))
             {
                 return result_type(jsoncons::unexpect, r.error());
             }
@@ -1336,7 +1373,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                     auto r = to_bigint(sv.data(), sv.length(), val);
                     if (JSONCONS_UNLIKELY(!r))
                     {
-                        return result_type(jsoncons::unexpect, conv_errc::not_bigint);
+                        return detail::conv_error<result_type>(conv_errc::not_bigint);
                     }
                     return result_type(std::move(val));
                 }
@@ -1348,16 +1385,14 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 }
                 case json_type::int64_value:
                 {
-                    auto res = j.template try_as<int64_t>(aset);
-                    return res ? result_type(jsoncons::in_place, *res) : result_type(jsoncons::unexpect, conv_errc::not_bigint);
+                    return result_type(jsoncons::in_place, j.template as_integer<int64_t>());
                 }
                 case json_type::uint64_value:
                 {
-                    auto res = j.template try_as<uint64_t>(aset);
-                    return res ? result_type(jsoncons::in_place, *res) : result_type(jsoncons::unexpect, conv_errc::not_bigint);
+                    return result_type(jsoncons::in_place, j.template as_integer<uint64_t>());
                 }
                 default:
-                    return result_type(jsoncons::unexpect, conv_errc::not_bigint);
+                    return detail::conv_error<result_type>(conv_errc::not_bigint);
             }
         }
         
@@ -1380,19 +1415,7 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (const auto& e : j.array_range())
-                {
-                    if (!e.template is<T>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && detail::array_elements_match<Json,T>(j);
         }
         
         template <typename Alloc, typename TempAlloc>
@@ -1401,106 +1424,33 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
             if (j.is_array())
             {
                 std::valarray<T> v(j.size());
-                for (std::size_t i = 0; i < j.size(); ++i)
+                std::size_t i = 0;
+                for (const auto& item : j.array_range())
                 {
-                    auto res = j[i].template try_as<T>(aset);
+                    auto res = item.template try_as<T>(aset);
                     if (JSONCONS_UNLIKELY(!res))
                     {
-                        return result_type(jsoncons::unexpect, conv_errc::not_array);
+                        return detail::conv_error<result_type>(conv_errc::not_array);
                     }
-                    v[i] = std::move(*res);
+                    v[i++] = std::move(*res);
                 }
                 return result_type(std::move(v));
             }
             else
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_array);
+                return detail::conv_error<result_type>(conv_errc::not_array);
             }
         }
         
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::valarray<T>& val)
         {
-            Json j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg, semantic_tag::none);
-            auto first = std::begin(val);
-            auto last = std::end(val);
-            std::size_t size = std::distance(first,last);
-            j.reserve(size);
-            for (auto it = first; it != last; ++it)
-            {
-                j.push_back(*it);
-            }
-            return j;
+            return detail::json_array_from_range<Json>(aset, val);
         }
     };
 
 #if defined(JSONCONS_HAS_STD_VARIANT)
 
-namespace variant_detail
-{
-    template<int N,typename Json,typename Variant,typename ... Args>
-    typename std::enable_if<N == std::variant_size_v<Variant>, bool>::type
-    is_variant(const Json& /*j*/)
-    {
-        return false;
-    }
-
-    template<std::size_t N,typename Json,typename Variant,typename T,typename ... U>
-    typename std::enable_if<N < std::variant_size_v<Variant>, bool>::type
-    is_variant(const Json& j)
-    {
-      if (j.template is<T>())
-      {
-          return true;
-      }
-      else
-      {
-          return is_variant<N+1, Json, Variant, U...>(j);
-      }
-    }
-
-    template<int N,typename Json,typename Variant,typename Alloc,typename TempAlloc,typename ... Args>
-    typename std::enable_if<N == std::variant_size_v<Variant>, conversion_result<Variant>>::type
-    as_variant(const allocator_set<Alloc,TempAlloc>&, const Json& /*j*/)
-    {
-        return conversion_result<Variant>(jsoncons::unexpect, conv_errc::not_variant);
-    }
-
-    template<std::size_t N,typename Json,typename Variant,typename Alloc,typename TempAlloc,typename T,typename ... U>
-    typename std::enable_if<N < std::variant_size_v<Variant>, conversion_result<Variant>>::type
-    as_variant(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
-    {
-        using result_type = conversion_result<Variant>;
-        if (j.template is<T>())
-      {
-          auto res = j.template try_as<T>(aset);
-          if (JSONCONS_UNLIKELY(!res))
-          {
-              return result_type(jsoncons::unexpect, conv_errc::not_variant);
-          }
-          return conversion_result<Variant>(jsoncons::in_place, std::move(*res));
-      }
-      else
-      {
-          return as_variant<N+1, Json, Variant, Alloc, TempAlloc, U...>(aset, j);
-      }
-    }
-
-    template <typename Json>
-    struct variant_to_json_visitor
-    {
-        Json& j_;
-
-        variant_to_json_visitor(Json& j) : j_(j) {}
-
-        template <typename T>
-        void operator()(const T& value) const
-        {
-            j_ = value;
-        }
-    };
-
-} // namespace variant_detail
 
     template <typename Json,typename... VariantTypes>
     struct json_conv_traits<Json, std::variant<VariantTypes...>>
@@ -1511,23 +1461,53 @@ namespace variant_detail
 
         static bool is(const Json& j) noexcept
         {
-            return variant_detail::is_variant<0,Json,variant_type, VariantTypes...>(j); 
+            return (j.template is<VariantTypes>() || ...);
         }
 
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            return result_type(variant_detail::as_variant<0,Json,variant_type,Alloc,TempAlloc,VariantTypes...>(aset, j)); 
+            result_type result(jsoncons::unexpect, conv_errc::not_variant);
+            (void)(try_as_alternative_<VariantTypes>(aset, j, result) || ...);
+            return result;
+        }
+
+    private:
+        // Returns true once an alternative's is() matches, ending the fold.
+        // As with the earlier recursive form, a match that then fails to
+        // convert keeps the not_variant error rather than trying later
+        // alternatives.
+        template <typename T, typename Alloc, typename TempAlloc>
+        static bool try_as_alternative_(const allocator_set<Alloc,TempAlloc>& aset, const Json& j, result_type& result)
+        {
+            if (!j.template is<T>())
+            {
+                return false;
+            }
+            auto res = j.template try_as<T>(aset);
+            if (JSONCONS_LIKELY(static_cast<bool>(res)))
+            {
+                result = result_type(jsoncons::in_place, std::move(*res));
+            }
+            return true;
         }
 
+    public:
+
         template <typename Alloc, typename TempAlloc>
-        static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::variant<VariantTypes...>& var)
+        static Json to_json(const allocator_set<Alloc,TempAlloc>&, const std::variant<VariantTypes...>& var)
         {
-            Json j = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_array_arg, semantic_tag::none);
-            variant_detail::variant_to_json_visitor<Json> visitor(j);
-            std::visit(visitor, var);
+            Json j;
+            to_json_(var, j, std::index_sequence_for<VariantTypes...>{});
             return j;
         }
+
+    private:
+        template <std::size_t... I>
+        static void to_json_(const std::variant<VariantTypes...>& var, Json& j, std::index_sequence<I...>)
+        {
+            (void)((var.index() == I && (j = std::get<I>(var), true)) || ...);
+        }
     };
 #endif
 
@@ -1586,18 +1566,23 @@ namespace variant_detail
                     case semantic_tag::epoch_second:
                     {
                         auto res = j.template try_as<Rep>();
-                        if (!res)
+                        if (JSONCONS_UNLIKELY(!res))
                         {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                            return detail::conv_error<result_type>(conv_errc::not_epoch);
                         }
                         return result_type(in_place, *res);
                     }
                     case semantic_tag::epoch_milli:
                     {
                         auto sv = j.as_string_view();
+                        int64_t i64{0};
+                        if (detail::try_dec_to_int64(sv.data(), sv.length(), i64))
+                        {
+                            return result_type(in_place, static_cast<Rep>(i64 / millis_in_second));
+                        }
                         bigint n;
                         auto r = to_bigint(sv.data(), sv.length(), n);
-                        if (!r) {return result_type(jsoncons::unexpect, conv_errc::not_epoch);}
+                        if (JSONCONS_UNLIKELY(!r)) {return detail::conv_error<result_type>(conv_errc::not_epoch);}
                         if (n != 0)
                         {
                             n = n / millis_in_second;
@@ -1607,9 +1592,14 @@ namespace variant_detail
                     case semantic_tag::epoch_nano:
                     {
                         auto sv = j.as_string_view();
+                        int64_t i64{0};
+                        if (detail::try_dec_to_int64(sv.data(), sv.length(), i64))
+                        {
+                            return result_type(in_place, static_cast<Rep>(i64 / nanos_in_second));
+                        }
                         bigint n;
                         auto r = to_bigint(sv.data(), sv.length(), n);
-                        if (!r) {return result_type(jsoncons::unexpect, conv_errc::not_epoch);}
+                        if (JSONCONS_UNLIKELY(!r)) {return detail::conv_error<result_type>(conv_errc::not_epoch);}
                         if (n != 0)
                         {
                             n = n / nanos_in_second;
@@ -1619,9 +1609,9 @@ namespace variant_detail
                     default:
                     {
                         auto res = j.template try_as<Rep>(aset);
-                        if (!res)
+                        if (JSONCONS_UNLIKELY(!res))
                         {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                            return detail::conv_error<result_type>(conv_errc::not_epoch);
                         }
                         return result_type(in_place, *res);
                     }
@@ -1629,7 +1619,7 @@ namespace variant_detail
             }
             else
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                return detail::conv_error<result_type>(conv_errc::not_epoch);
             }
         }
 
@@ -1638,31 +1628,12 @@ namespace variant_detail
         typename std::enable_if<std::is_same<PeriodT,std::milli>::value, result_type>::type
         from_json_(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (j.is_int64() || j.is_uint64())
-            {
-                auto res = j.template try_as<Rep>();
-                if (!res)
-                {
-                    return result_type(jsoncons::unexpect, conv_errc::not_epoch);
-                }
-                switch (j.tag())
-                {
-                    case semantic_tag::epoch_second:
-                        return result_type(in_place, *res*millis_in_second);
-                    case semantic_tag::epoch_milli:
-                        return result_type(in_place, *res);
-                    case semantic_tag::epoch_nano:
-                        return result_type(in_place, *res == 0 ? 0 : *res/nanos_in_milli);
-                    default:
-                        return result_type(in_place, *res);
-                }
-            }
-            else if (j.is_double())
+            if (j.is_double())
             {
                 auto res = j.template try_as<double>();
-                if (!res)
+                if (JSONCONS_UNLIKELY(!res))
                 {
-                    return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                    return detail::conv_error<result_type>(conv_errc::not_epoch);
                 }
                 switch (j.tag())
                 {
@@ -1671,65 +1642,77 @@ namespace variant_detail
                     case semantic_tag::epoch_milli:
                         return result_type(in_place, static_cast<Rep>(*res));
                     case semantic_tag::epoch_nano:
-                        return result_type(in_place, *res == 0 ? 0 : static_cast<Rep>(*res / nanos_in_milli));
+                        return result_type(in_place, static_cast<Rep>(*res / nanos_in_milli));
                     default:
                         return result_type(in_place, static_cast<Rep>(*res));
                 }
             }
-            else if (j.is_string())
+            if (j.is_string())
             {
-                switch (j.tag())
+                // Tagged strings parse digits directly; strings that
+                // miss the fast path or carry other tags share the
+                // generic path below.
+                if (j.tag() == semantic_tag::epoch_second)
                 {
-                    case semantic_tag::epoch_second:
+                    auto sv = j.as_string_view();
+                    int64_t i64{0};
+                    if (detail::try_dec_to_int64(sv.data(), sv.length(), i64))
                     {
-                        auto res = j.template try_as<Rep>();
-                        if (!res)
-                        {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
-                        }
-                        return result_type(in_place, *res*millis_in_second);
+                        return result_type(in_place, static_cast<Rep>(i64 * millis_in_second));
                     }
-                    case semantic_tag::epoch_milli:
+                    // Non-integer payloads fall through to the generic
+                    // conversion below.
+                }
+                else if (j.tag() == semantic_tag::epoch_milli)
+                {
+                    auto res = j.try_as_string_view();
+                    if (JSONCONS_UNLIKELY(!res))
                     {
-                        auto res = j.try_as_string_view();
-                        if (!res)
-                        {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
-                        }
-                        Rep n{0};
-                        auto result = jsoncons::utility::dec_to_integer((*res).data(), (*res).size(), n);
-                        if (!result)
-                        {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
-                        }
-                        return result_type(in_place, n);
+                        return detail::conv_error<result_type>(conv_errc::not_epoch);
                     }
-                    case semantic_tag::epoch_nano:
+                    Rep n{0};
+                    auto result = jsoncons::utility::dec_to_integer((*res).data(), (*res).size(), n);
+                    if (JSONCONS_UNLIKELY(!result))
                     {
-                        auto sv = j.as_string_view();
-                        bigint n;
-                        auto r = to_bigint(sv.data(), sv.length(), n);
-                        if (!r) {return result_type(jsoncons::unexpect, conv_errc::not_epoch);}
-                        if (n != 0)
-                        {
-                            n = n / nanos_in_milli;
-                        }
-                        return result_type(in_place, static_cast<Rep>(n));
+                        return detail::conv_error<result_type>(conv_errc::not_epoch);
                     }
-                    default:
+                    return result_type(in_place, n);
+                }
+                else if (j.tag() == semantic_tag::epoch_nano)
+                {
+                    auto sv = j.as_string_view();
+                    int64_t i64{0};
+                    if (detail::try_dec_to_int64(sv.data(), sv.length(), i64))
                     {
-                        auto res = j.template try_as<Rep>(aset);
-                        if (!res)
-                        {
-                            return result_type(jsoncons::unexpect, conv_errc::not_epoch);
-                        }
-                        return result_type(in_place, *res);
+                        return result_type(in_place, static_cast<Rep>(i64 / nanos_in_milli));
                     }
+                    bigint n;
+                    auto r = to_bigint(sv.data(), sv.length(), n);
+                    if (JSONCONS_UNLIKELY(!r)) {return detail::conv_error<result_type>(conv_errc::not_epoch);}
+                    if (n != 0)
+                    {
+                        n = n / nanos_in_milli;
+                    }
+                    return result_type(in_place, static_cast<Rep>(n));
                 }
             }
-            else
+            else if (!(j.is_int64() || j.is_uint64()))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                return detail::conv_error<result_type>(conv_errc::not_epoch);
+            }
+            auto res = j.template try_as<Rep>(aset);
+            if (JSONCONS_UNLIKELY(!res))
+            {
+                return detail::conv_error<result_type>(conv_errc::not_epoch);
+            }
+            switch (j.tag())
+            {
+                case semantic_tag::epoch_second:
+                    return result_type(in_place, *res*millis_in_second);
+                case semantic_tag::epoch_nano:
+                    return result_type(in_place, *res/nanos_in_milli);
+                default:
+                    return result_type(in_place, *res);
             }
         }
 
@@ -1738,7 +1721,7 @@ namespace variant_detail
         typename std::enable_if<std::is_same<PeriodT,std::nano>::value, result_type>::type
         from_json_(const allocator_set<Alloc,TempAlloc>& aset, const Json& j)
         {
-            if (j.is_int64() || j.is_uint64() || j.is_double())
+            if (j.is_int64() || j.is_uint64())
             {
                 auto count = j.template as<Rep>();
                 switch (j.tag())
@@ -1771,9 +1754,9 @@ namespace variant_detail
             else if (j.is_string())
             {
                 auto res = j.template try_as<Rep>(aset);
-                if (!res)
+                if (JSONCONS_UNLIKELY(!res))
                 {
-                    return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                    return detail::conv_error<result_type>(conv_errc::not_epoch);
                 }
                 switch (j.tag())
                 {
@@ -1789,32 +1772,21 @@ namespace variant_detail
             }
             else
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_epoch);
+                return detail::conv_error<result_type>(conv_errc::not_epoch);
             }
         }
 
         template <typename Alloc,typename TempAlloc,typename PeriodT=Period>
-        static 
-        typename std::enable_if<std::is_same<PeriodT,std::ratio<1>>::value,Json>::type
-        to_json_(const allocator_set<Alloc,TempAlloc>& aset, const duration_type& val)
-        {
-            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), val.count(), semantic_tag::epoch_second);
-        }
-
-        template <typename Alloc,typename TempAlloc,typename PeriodT=Period>
-        static 
-        typename std::enable_if<std::is_same<PeriodT,std::milli>::value,Json>::type
+        static
+        typename std::enable_if<std::is_same<PeriodT,std::ratio<1>>::value ||
+                                std::is_same<PeriodT,std::milli>::value ||
+                                std::is_same<PeriodT,std::nano>::value,Json>::type
         to_json_(const allocator_set<Alloc,TempAlloc>& aset, const duration_type& val)
         {
-            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), val.count(), semantic_tag::epoch_milli);
-        }
-
-        template <typename Alloc,typename TempAlloc,typename PeriodT=Period>
-        static 
-        typename std::enable_if<std::is_same<PeriodT,std::nano>::value,Json>::type
-        to_json_(const allocator_set<Alloc,TempAlloc>& aset, const duration_type& val)
-        {
-            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), val.count(), semantic_tag::epoch_nano);
+            const semantic_tag tag = std::is_same<PeriodT,std::ratio<1>>::value ? semantic_tag::epoch_second
+                : std::is_same<PeriodT,std::milli>::value ? semantic_tag::epoch_milli
+                : semantic_tag::epoch_nano;
+            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), val.count(), tag);
         }
     };
 
@@ -1832,9 +1804,9 @@ namespace variant_detail
         template <typename Alloc, typename TempAlloc>
         static result_type try_as(const allocator_set<Alloc,TempAlloc>&, const Json& j)
         {
-            if (!j.is_null())
+            if (JSONCONS_UNLIKELY(!j.is_null()))
             {
-                return result_type(jsoncons::unexpect, conv_errc::not_nullptr);
+                return detail::conv_error<result_type>(conv_errc::not_nullptr);
             }
             return result_type(nullptr);
         }
@@ -1887,84 +1859,110 @@ namespace variant_detail
                 std::bitset<N> bs = static_cast<unsigned long long>(bits);
                 return result_type(std::move(bs));
             }
-            else if (j.is_byte_string() || j.is_string())
+            else if (j.is_byte_string())
             {
-                std::bitset<N> bs;
-                std::vector<uint8_t> bits;
-                if (j.is_byte_string())
+                // Unpack straight from the stored bytes instead of
+                // copying them into a vector first.
+                auto bsv = j.try_as_byte_string_view();
+                if (JSONCONS_UNLIKELY(!bsv))
                 {
-                    bits = j.template as<std::vector<uint8_t>>();
+                    return detail::conv_error<result_type>(conv_errc::not_bitset);
                 }
-                else
+                return try_unpack_((*bsv).data(), (*bsv).size());
+            }
+            else if (j.is_string())
+            {
+                jsoncons::string_view sv = j.as_string_view();
+                std::vector<uint8_t> bits;
+                bits.reserve(sv.size()/2);
+                auto result = base16_to_bytes(sv.begin(), sv.end(), bits);
+                if (JSONCONS_UNLIKELY(result.ec != conv_errc::success))
                 {
-                    jsoncons::string_view sv = j.as_string_view();
-                    auto result = base16_to_bytes(sv.begin(), sv.end(), bits);
-                    if (result.ec != conv_errc::success)
-                    {
-                        return result_type(jsoncons::unexpect, conv_errc::not_bitset);
-                    }
+                    return detail::conv_error<result_type>(conv_errc::not_bitset);
                 }
-                std::uint8_t byte = 0;
-                std::uint8_t mask  = 0;
+                return try_unpack_(bits.data(), bits.size());
+            }
+            else
+            {
+                return detail::conv_error<result_type>(conv_errc::not_bitset);
+            }
+        }
 
-                std::size_t pos = 0;
-                for (std::size_t i = 0; i < N; ++i)
+    private:
+        static result_type try_unpack_(const uint8_t* bits, std::size_t size)
+        {
+            // One length check up front replaces the per-byte reload
+            // test and the bounds-checked at(); the unpack loop then
+            // runs without a data-dependent branch.
+            constexpr std::size_t num_bytes = (N + 7) / 8;
+            if (JSONCONS_UNLIKELY(size < num_bytes))
+            {
+                return detail::conv_error<result_type>(conv_errc::not_bitset);
+            }
+            std::bitset<N> bs;
+            constexpr std::size_t full_bytes = N / 8;
+            for (std::size_t k = 0; k < full_bytes; ++k)
+            {
+                const uint8_t byte = bits[k];
+                const std::size_t base = k*8;
+                for (std::size_t r = 0; r < 8; ++r)
+                {
+                    bs[base + r] = ((byte >> (7 - r)) & 1) != 0;
+                }
+            }
+            if (N % 8 != 0)
+            {
+                const uint8_t byte = bits[full_bytes];
+                uint8_t mask = 0x80;
+                for (std::size_t i = full_bytes*8; i < N; ++i)
                 {
-                    if (mask == 0)
-                    {
-                        if (pos >= bits.size())
-                        {
-                            return result_type(jsoncons::unexpect, conv_errc::not_bitset);
-                        }
-                        byte = bits.at(pos++);
-                        mask = 0x80;
-                    }
-
                     if (byte & mask)
                     {
                         bs[i] = 1;
                     }
-
-                    mask = static_cast<std::uint8_t>(mask >> 1);
+                    mask = static_cast<uint8_t>(mask >> 1);
                 }
-                return result_type(std::move(bs));
-            }
-            else
-            {
-                return result_type(jsoncons::unexpect, conv_errc::not_bitset);
             }
+            return result_type(std::move(bs));
         }
 
+    public:
+
         template <typename Alloc, typename TempAlloc>
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const std::bitset<N>& val)
         {
             using temp_alloc_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<uint8_t>;
-            std::vector<uint8_t,temp_alloc_type> bits(aset.get_temp_allocator());
+            std::vector<uint8_t,temp_alloc_type> bits((N + 7) / 8, 0, aset.get_temp_allocator());
 
-            uint8_t byte = 0;
-            uint8_t mask = 0x80;
-
-            for (std::size_t i = 0; i < N; ++i)
+            // Pack one output byte per iteration. The fixed-count inner
+            // loop has no cross-iteration mask state, so the compiler can
+            // unroll it fully.
+            constexpr std::size_t full_bytes = N / 8;
+            for (std::size_t k = 0; k < full_bytes; ++k)
             {
-                if (val[i])
+                uint8_t byte = 0;
+                const std::size_t base = k*8;
+                for (std::size_t r = 0; r < 8; ++r)
                 {
-                    byte |= mask;
-                }
-
-                mask = static_cast<uint8_t>(mask >> 1);
-
-                if (mask == 0)
-                {
-                    bits.push_back(byte);
-                    byte = 0;
-                    mask = 0x80;
+                    byte = static_cast<uint8_t>((byte << 1) | static_cast<uint8_t>(val[base + r]));
                 }
+                bits[k] = byte;
             }
 
             // Encode remainder
-            if (mask != 0x80)
+            if (N % 8 != 0)
             {
-                bits.push_back(byte);
+                uint8_t byte = 0;
+                uint8_t mask = 0x80;
+                for (std::size_t i = full_bytes*8; i < N; ++i)
+                {
+                    if (val[i])
+                    {
+                        byte |= mask;
+                    }
+                    mask = static_cast<uint8_t>(mask >> 1);
+                }
+                bits[full_bytes] = byte;
             }
 
             return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), byte_string_arg, bits, semantic_tag::base16);
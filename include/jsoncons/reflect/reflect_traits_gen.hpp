@@ -7,7 +7,10 @@
 #ifndef JSONCONS_REFLECT_REFLECT_TRAITS_GEN_HPP
 #define JSONCONS_REFLECT_REFLECT_TRAITS_GEN_HPP
 
+#include <algorithm>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp> // JSONCONS_PP_EXPAND, JSONCONS_PP_QUOTE
@@ -32,7 +35,7 @@ namespace reflect {
 struct always_true
 {
     template< typename T>
-    constexpr bool operator()(const T&) const noexcept
+    JSONCONS_FORCE_INLINE constexpr bool operator()(const T&) const noexcept
     {
         return true;
     }
@@ -41,7 +44,7 @@ struct always_true
 struct identity
 {
     template< typename T>
-    constexpr T&& operator()(T&& val) const noexcept
+    JSONCONS_FORCE_INLINE constexpr T&& operator()(T&& val) const noexcept
     {
         return std::forward<T>(val);
     }
@@ -55,10 +58,71 @@ template <typename T>
 struct reflect_type_properties
 {};
 
-template <typename T, typename U> 
-void set_member(T&&, const U&) 
-{ 
-} 
+// Name-ordered and value-ordered copies of the enum table declared by
+// reflect_type_properties, built once on first use so that the enum
+// conversions can use binary search instead of a linear scan.
+// stable_sort keeps declaration order among duplicates, preserving the
+// first-match behaviour of the linear scan it replaces.
+template <typename EnumType,typename CharT>
+class enum_name_table
+{
+public:
+    using mapped_type = std::pair<EnumType,basic_string_view<CharT>>;
+
+    static const mapped_type* find_by_name(const basic_string_view<CharT>& name)
+    {
+        static const std::vector<mapped_type> sorted = sort_table(name_less);
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), name,
+            [](const mapped_type& item, const basic_string_view<CharT>& key) -> bool
+            { return item.second < key; });
+        return (it != sorted.end() && (*it).second == name) ? &(*it) : nullptr;
+    }
+
+    static const mapped_type* find_by_value(EnumType value)
+    {
+        static const std::vector<mapped_type> sorted = sort_table(value_less);
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), value,
+            [](const mapped_type& item, EnumType key) -> bool
+            { return item.first < key; });
+        return (it != sorted.end() && (*it).first == value) ? &(*it) : nullptr;
+    }
+
+private:
+    static bool name_less(const mapped_type& lhs, const mapped_type& rhs)
+    {
+        return lhs.second < rhs.second;
+    }
+
+    static bool value_less(const mapped_type& lhs, const mapped_type& rhs)
+    {
+        return lhs.first < rhs.first;
+    }
+
+    static std::vector<mapped_type> sort_table(bool (*less)(const mapped_type&, const mapped_type&))
+    {
+        auto first = reflect_type_properties<EnumType>::template values<CharT>();
+        std::vector<mapped_type> sorted(first, first + reflect_type_properties<EnumType>::count);
+        std::stable_sort(sorted.begin(), sorted.end(), less);
+        return sorted;
+    }
+};
+
+// Matches the member types that the generated traits treat as "may be
+// absent": a missing JSON member leaves them empty, and an empty value
+// is not emitted.
+template <typename T>
+struct is_optional_like : std::false_type {};
+template <typename U>
+struct is_optional_like<std::shared_ptr<U>> : std::true_type {};
+template <typename U,typename Deleter>
+struct is_optional_like<std::unique_ptr<U,Deleter>> : std::true_type {};
+template <typename U>
+struct is_optional_like<jsoncons::optional<U>> : std::true_type {};
+
+template <typename T, typename U>
+void set_member(T&&, const U&)
+{
+}
 template <typename T, typename U> 
 void set_member(T&& val, U& result)
 { 
@@ -75,107 +139,145 @@ struct json_traits_helper
         const Json& j, string_view_type key) 
     { 
         auto it = j.find(key);
-        if (it == j.object_range().end())
+        if (JSONCONS_UNLIKELY(it == j.object_range().end()))
         {
             return conversion_result<T>(unexpect, conv_errc::missing_required_member);
         }
-        auto result = it->value().template try_as<T>(aset); 
-        if (!result)
+        auto result = it->value().template try_as<T>(aset);
+        if (JSONCONS_UNLIKELY(!result))
         {
             return conversion_result<T>(unexpect, result.error());
         }
         return conversion_result<T>(std::move(*result));
-    } 
+    }
 
-    template <typename U> 
-    static void set_optional_json_member(string_view_type key, const std::shared_ptr<U>& val, Json& j) 
-    { 
-        if (val) j.try_emplace(key, val); 
-    } 
-    template <typename U,typename Deleter> 
-    static void set_optional_json_member(string_view_type key, const std::unique_ptr<U,Deleter>& val, Json& j) 
-    { 
-        if (val) j.try_emplace(key, val); 
-    } 
-    template <typename U> 
-    static void set_optional_json_member(string_view_type key, const jsoncons::optional<U>& val, Json& j) 
-    { 
-        if (val) j.try_emplace(key, val); 
-    } 
-    template <typename U> 
-    static void set_optional_json_member(string_view_type key, const U& val, Json& j) 
-    { 
-        j.try_emplace(key, val); 
-    } 
+    // Lockstep fast path: when the object's members arrive in declared
+    // order (common for machine-generated JSON and for the sorted policy
+    // with alphabetical declarations), the hint iterator satisfies each
+    // lookup without searching and advances to the next member. On a
+    // mismatch, fall back to find() and resync the hint past the match.
+    template <typename T,typename Alloc,typename TempAlloc>
+    static conversion_result<T> try_get_member(const allocator_set<Alloc,TempAlloc>& aset,
+        const Json& j, string_view_type key, typename Json::const_object_iterator& hint)
+    {
+        auto it = j.object_range().end();
+        if (hint != it && hint->key() == key)
+        {
+            it = hint;
+        }
+        else
+        {
+            it = j.find(key);
+            if (JSONCONS_UNLIKELY(it == j.object_range().end()))
+            {
+                return conversion_result<T>(unexpect, conv_errc::missing_required_member);
+            }
+        }
+        hint = it;
+        ++hint;
+        auto result = it->value().template try_as<T>(aset);
+        if (JSONCONS_UNLIKELY(!result))
+        {
+            return conversion_result<T>(unexpect, result.error());
+        }
+        return conversion_result<T>(std::move(*result));
+    }
+
+    // Membership-only flavour of the lockstep lookup above, for the
+    // is() sweeps: a whole-object validation probes every declared name,
+    // so in-order input resolves each probe from the hint in O(1).
+    static bool has_member(const Json& j, string_view_type key,
+        typename Json::const_object_iterator& hint)
+    {
+        auto it = j.object_range().end();
+        if (hint != it && hint->key() == key)
+        {
+            it = hint;
+        }
+        else
+        {
+            it = j.find(key);
+            if (JSONCONS_UNLIKELY(it == j.object_range().end()))
+            {
+                return false;
+            }
+        }
+        hint = it;
+        ++hint;
+        return true;
+    }
+
+    // One generated line per member: the mandatory/optional split is a
+    // compile-time bool, so the unused arm is never instantiated.
+    template <bool IsMandatory,typename U>
+    JSONCONS_FORCE_INLINE static typename std::enable_if<IsMandatory>::type
+    add_member(string_view_type key, const U& val, Json& j)
+    {
+        j.try_emplace(key, val);
+    }
+    template <bool IsMandatory,typename U>
+    JSONCONS_FORCE_INLINE static typename std::enable_if<!IsMandatory>::type
+    add_member(string_view_type key, const U& val, Json& j)
+    {
+        set_optional_json_member(key, val, j);
+    }
+
+    template <typename U>
+    JSONCONS_FORCE_INLINE static typename std::enable_if<is_optional_like<U>::value>::type
+    set_optional_json_member(string_view_type key, const U& val, Json& j)
+    {
+        // Dereference so the object stores the pointed-to value directly;
+        // passing the wrapper would bump a shared_ptr use count (an atomic
+        // op) only to unwrap it again inside the conversion.
+        if (val) j.try_emplace(key, *val);
+    }
+    template <typename U>
+    JSONCONS_FORCE_INLINE static typename std::enable_if<!is_optional_like<U>::value>::type
+    set_optional_json_member(string_view_type key, const U& val, Json& j)
+    {
+        j.try_emplace(key, val);
+    }
 };
 
 template <typename CharT, typename T> 
-write_result try_encode_member(const basic_string_view<CharT>& key, const T& val, basic_json_visitor<CharT>& encoder) 
+JSONCONS_FORCE_INLINE write_result try_encode_member(const basic_string_view<CharT>& key, const T& val, basic_json_visitor<CharT>& encoder) 
 { 
     encoder.key(key);
     return encode_traits<T>::try_encode(make_alloc_set(), val, encoder); 
 } 
 
-template <typename CharT, typename T> 
-write_result try_encode_optional_member(const basic_string_view<CharT>& key, const std::shared_ptr<T>& val, basic_json_visitor<CharT>& encoder) 
-{ 
-    if (val) 
-    {
-        encoder.key(key);
-        return encode_traits<T>::try_encode(make_alloc_set(), *val, encoder); 
-    }
-    return write_result{}; 
-}
- 
-template <typename CharT, typename T,typename Deleter> 
-write_result try_encode_optional_member(const basic_string_view<CharT>& key, const std::unique_ptr<T,Deleter>& val, basic_json_visitor<CharT>& encoder) 
-{ 
+template <typename CharT, typename T>
+JSONCONS_FORCE_INLINE typename std::enable_if<is_optional_like<T>::value,write_result>::type
+try_encode_optional_member(const basic_string_view<CharT>& key, const T& val, basic_json_visitor<CharT>& encoder)
+{
     if (val)
     {
         encoder.key(key);
-        return encode_traits<T>::try_encode(make_alloc_set(), *val, encoder); 
+        return encode_traits<typename std::decay<decltype(*val)>::type>::try_encode(make_alloc_set(), *val, encoder);
     }
-    return write_result{}; 
+    return write_result{};
 }
- 
-template <typename CharT, typename T> 
-write_result try_encode_optional_member(const basic_string_view<CharT>& key, const jsoncons::optional<T>& val, basic_json_visitor<CharT>& encoder) 
-{ 
-    if (val)
-    {
-        encoder.key(key);
-        return encode_traits<T>::try_encode(make_alloc_set(), *val, encoder); 
-    }
-    return write_result{}; 
-} 
 
-template <typename CharT, typename T> 
-write_result try_encode_optional_member(const basic_string_view<CharT>& key, const T& val, basic_json_visitor<CharT>& encoder) 
-{ 
+template <typename CharT, typename T>
+JSONCONS_FORCE_INLINE typename std::enable_if<!is_optional_like<T>::value,write_result>::type
+try_encode_optional_member(const basic_string_view<CharT>& key, const T& val, basic_json_visitor<CharT>& encoder)
+{
     encoder.key(key);
-    return encode_traits<T>::try_encode(make_alloc_set(), val, encoder); 
-} 
+    return encode_traits<T>::try_encode(make_alloc_set(), val, encoder);
+}
 
-template <typename T> 
-bool is_optional_value_set(const std::shared_ptr<T>& val) 
-{ 
-    return val ? true : false; 
-} 
-template <typename T,typename Deleter> 
-bool is_optional_value_set(const std::unique_ptr<T,Deleter>& val) 
-{ 
-    return val ? true : false;
-} 
-template <typename T> 
-bool is_optional_value_set(const jsoncons::optional<T>& val) 
-{ 
+template <typename T>
+JSONCONS_FORCE_INLINE typename std::enable_if<is_optional_like<T>::value,bool>::type
+is_optional_value_set(const T& val) noexcept
+{
     return val ? true : false;
-} 
-template <typename T> 
-bool is_optional_value_set(const T&) 
+}
+template <typename T>
+constexpr typename std::enable_if<!is_optional_like<T>::value,bool>::type
+is_optional_value_set(const T&) noexcept
 {
-    return true; 
-} 
+    return true;
+}
 
 } // namespace reflect
 
@@ -359,27 +461,27 @@ using identity = reflect::identity;
 
 #define JSONCONS_GENERATE_NAME_STR(Prefix, P2, P3, Member, Count) JSONCONS_GENERATE_NAME_STR_LAST(Prefix, P2, P3, Member, Count) 
 #define JSONCONS_GENERATE_NAME_STR_LAST(Prefix, P2, P3, Member, Count) \
-    static inline const string_view& Member(char) {static const string_view sv = JSONCONS_PP_QUOTE(,Member); return sv;} \
-    static inline const wstring_view& Member(wchar_t) {static const wstring_view sv = JSONCONS_PP_QUOTE(L,Member); return sv;} \
-    static inline const string_view& Member(unexpect_t) {static const string_view sv = # Prefix ": " # Member; return sv;} \
+    static string_view Member(char) noexcept {return string_view(JSONCONS_PP_QUOTE(,Member), sizeof(JSONCONS_PP_QUOTE(,Member))-1);} \
+    static wstring_view Member(wchar_t) noexcept {return wstring_view(JSONCONS_PP_QUOTE(L,Member), sizeof(JSONCONS_PP_QUOTE(L,Member))/sizeof(wchar_t)-1);} \
+    static string_view Member(unexpect_t) noexcept {return string_view(# Prefix ": " # Member, sizeof(# Prefix ": " # Member)-1);} \
     /**/
 
 #define JSONCONS_N_MEMBER_IS(Prefix, P2, P3, Member, Count) JSONCONS_N_MEMBER_IS_LAST(Prefix, P2, P3, Member, Count)
-#define JSONCONS_N_MEMBER_IS_LAST(Prefix, P2, P3, Member, Count) if ((num_params-Count) < num_mandatory_params1 && !ajson.contains(json_object_name_members<value_type>::Member(char_type{}))) return false;
+#define JSONCONS_N_MEMBER_IS_LAST(Prefix, P2, P3, Member, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params1) {if (!json_traits_helper<Json>::has_member(ajson, json_object_name_members<value_type>::Member(char_type{}), member_it)) {return false;}}
 
 #define JSONCONS_N_MEMBER_AS(Prefix,P2,P3, Member, Count) JSONCONS_N_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count)
 #define JSONCONS_N_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count) { \
-  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(class_instance.Member)>::type>(aset, ajson, json_object_name_members<value_type>::Member(char_type{})); \
+  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(class_instance.Member)>::type>(aset, ajson, json_object_name_members<value_type>::Member(char_type{}), member_it); \
   if (result) { \
     set_member(std::move(*result), class_instance.Member); \
   } \
-  else if ((num_params-Count) < num_mandatory_params2) {return result_type(jsoncons::unexpect, result.error().code(), json_object_name_members<value_type>::Member(unexpect));} \
+  else JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) {return result_type(jsoncons::unexpect, result.error().code(), json_object_name_members<value_type>::Member(unexpect));} \
   else if (result.error().code() != conv_errc::missing_required_member){return result_type(jsoncons::unexpect, result.error().code(), json_object_name_members<value_type>::Member(unexpect));} \
 }
 
 #define JSONCONS_ALL_MEMBER_AS(Prefix, P2,P3,Member, Count) JSONCONS_ALL_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count)
 #define JSONCONS_ALL_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count) { \
-  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(class_instance.Member)>::type>(aset, ajson, json_object_name_members<value_type>::Member(char_type{})); \
+  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(class_instance.Member)>::type>(aset, ajson, json_object_name_members<value_type>::Member(char_type{}), member_it); \
   if (result) { \
     set_member(std::move(*result), class_instance.Member); \
   } \
@@ -387,9 +489,8 @@ using identity = reflect::identity;
 }
 
 #define JSONCONS_TO_JSON(Prefix, P2, P3, Member, Count) JSONCONS_TO_JSON_LAST(Prefix, P2, P3, Member, Count)
-#define JSONCONS_TO_JSON_LAST(Prefix, P2, P3, Member, Count) if ((num_params-Count) < num_mandatory_params2) \
-    {ajson.try_emplace(json_object_name_members<value_type>::Member(char_type{}),class_instance.Member);} \
-    else {json_traits_helper<Json>::set_optional_json_member(json_object_name_members<value_type>::Member(char_type{}),class_instance.Member, ajson);}
+#define JSONCONS_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
+    json_traits_helper<Json>::template add_member<(num_params-Count) < num_mandatory_params2>(json_object_name_members<value_type>::Member(char_type{}),class_instance.Member, ajson);
 
 #define JSONCONS_ALL_TO_JSON(Prefix, P2, P3, Member, Count) JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count)
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
@@ -397,7 +498,7 @@ using identity = reflect::identity;
 
 #define JSONCONS_N_MEMBER_ENCODE(Prefix, P2, P3, Member, Count) JSONCONS_N_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count)
 #define JSONCONS_N_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
     { \
         auto r = try_encode_member(json_object_name_members<value_type>::Member(char_type{}), val.Member, encoder); \
         if (JSONCONS_UNLIKELY(!r)) {return r;} \
@@ -415,16 +516,12 @@ if ((num_params-Count) < num_mandatory_params2) \
 
 #define JSONCONS_MEMBER_COUNT(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count)
 #define JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Member)) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Member)); \
 } 
 
 #define JSONCONS_MEMBER_TRAITS_BASE(ToJson,Encode,NumTemplateParams,ClassName,NumMandatoryParams1,NumMandatoryParams2, ...)  \
@@ -448,14 +545,16 @@ namespace reflect { \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_object()) return false; \
+            auto member_it = ajson.object_range().begin(); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_MEMBER_IS, ,,, __VA_ARGS__)\
             return true; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, # ClassName); \
+            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, string_view(# ClassName, sizeof(# ClassName)-1)); \
             value_type class_instance = jsoncons::make_obj_using_allocator<value_type>(aset.get_allocator()); \
+            auto member_it = ajson.object_range().begin(); \
             if (num_params == num_mandatory_params2) \
             { \
                 JSONCONS_VARIADIC_FOR_EACH(JSONCONS_ALL_MEMBER_AS,,,, __VA_ARGS__) \
@@ -470,6 +569,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(ToJson, ,,, __VA_ARGS__) \
             return ajson; \
         } \
@@ -488,12 +588,13 @@ namespace reflect { \
             std::error_code ec; \
             using char_type = CharT; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_MEMBER_COUNT, ,,, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(Encode, ,,, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -524,13 +625,17 @@ namespace reflect { \
 
 #define JSONCONS_MEMBER_NAME_IS(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_IS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_MEMBER_NAME_IS_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params1 && JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_MEMBER_NAME_IS_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_MEMBER_NAME_IS_2(Member, Name) !ajson.contains(Name)) return false;
+#define JSONCONS_MEMBER_NAME_IS_2(Member, Name) !json_traits_helper<Json>::has_member(ajson, Name, member_it)) return false;
 #define JSONCONS_MEMBER_NAME_IS_3(Member, Name, Mode) JSONCONS_MEMBER_NAME_IS_2(Member, Name)
 #define JSONCONS_MEMBER_NAME_IS_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, , )
 #define JSONCONS_MEMBER_NAME_IS_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, )
-#define JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>())) return false;} \
-    JSONCONS_CATCH(...) {return false;}
+#define JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, From) false) {} \
+    {auto _it = ajson.find(Name); \
+    if (_it == ajson.object_range().end()) {return false;} \
+    member_it = _it; \
+    ++member_it; \
+    auto _r = _it->value().template try_as<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(); \
+    if (!_r || !Match(*_r)) {return false;}}
 
 #define JSONCONS_N_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) index = num_params-Count; JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_MEMBER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
@@ -540,7 +645,7 @@ namespace reflect { \
 #define JSONCONS_N_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) JSONCONS_N_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into,)
 #define JSONCONS_N_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) JSONCONS_N_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into, From)
 #define JSONCONS_N_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into, From) { \
-  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into(class_instance.Member))>::type>(aset, ajson, Name); \
+  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into(class_instance.Member))>::type>(aset, ajson, Name, member_it); \
   if (result && !Match(From(* result))) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);} \
   Mode(JSONCONS_N_MEMBER_NAME_AS_8(Member, Name, Mode, Match, Into, From)) }
 #define JSONCONS_N_MEMBER_NAME_AS_8(Member, Name, Mode, Match, Into, From) \
@@ -558,7 +663,7 @@ namespace reflect { \
 #define JSONCONS_ALL_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) JSONCONS_ALL_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into,)
 #define JSONCONS_ALL_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) JSONCONS_ALL_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into, From)
 #define JSONCONS_ALL_MEMBER_NAME_AS_7(Member, Name, Mode, Match, Into, From) { \
-  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into(class_instance.Member))>::type>(aset, ajson, Name); \
+  auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into(class_instance.Member))>::type>(aset, ajson, Name, member_it); \
   if (result && !Match(From(* result))) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);} \
   Mode(JSONCONS_ALL_MEMBER_NAME_AS_8(Member, Name, Mode, Match, Into, From)) }
 #define JSONCONS_ALL_MEMBER_NAME_AS_8(Member, Name, Mode, Match, Into, From) \
@@ -568,7 +673,7 @@ namespace reflect { \
   else {return result_type(jsoncons::unexpect, result.error().code(), class_name);} 
 
 #define JSONCONS_N_MEMBER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_MEMBER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_MEMBER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_N_MEMBER_NAME_TO_JSON_2(Member, Name) \
   {ajson.try_emplace(Name,class_instance.Member);} \
 else \
@@ -590,7 +695,7 @@ else \
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, From) ajson.try_emplace(Name, Into(class_instance.Member));
 
 #define JSONCONS_N_MEMBER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_N_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_MEMBER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_N_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_MEMBER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_N_MEMBER_NAME_ENCODE_2(Member, Name) \
     { \
         auto r = try_encode_member(string_view_type(Name), val.Member, encoder); \
@@ -626,31 +731,23 @@ else \
     {auto r = try_encode_member(string_view_type(Name), Into(val.Member), encoder); if (JSONCONS_UNLIKELY(!r)) {return r;}} 
 
 #define JSONCONS_MEMBER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_MEMBER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_MEMBER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_MEMBER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_MEMBER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_MEMBER_NAME_COUNT_2(Member, Name) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Member)) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Member)); \
 }    
 #define JSONCONS_MEMBER_NAME_COUNT_3(Member, Name, Mode) JSONCONS_MEMBER_NAME_COUNT_2(Member, Name)
 #define JSONCONS_MEMBER_NAME_COUNT_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_COUNT_6(Member, Name, Mode, Match,,)
 #define JSONCONS_MEMBER_NAME_COUNT_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_COUNT_6(Member, Name, Mode, Match, Into, )
 #define JSONCONS_MEMBER_NAME_COUNT_6(Member, Name, Mode, Match, Into, From) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Member)) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Member)); \
 }    
 
 #define JSONCONS_MEMBER_NAME_TRAITS_BASE(ToJson,Encode, NumTemplateParams, ClassName,NumMandatoryParams1,NumMandatoryParams2, ...)  \
@@ -669,16 +766,18 @@ namespace reflect { \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_object()) return false; \
+            auto member_it = ajson.object_range().begin(); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_MEMBER_NAME_IS,,,, __VA_ARGS__)\
             return true; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            const char* class_name = # ClassName; \
+            const string_view class_name(# ClassName, sizeof(# ClassName)-1); \
             std::error_code ec; \
-            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, # ClassName); \
+            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, class_name); \
             value_type class_instance = jsoncons::make_obj_using_allocator<value_type>(aset.get_allocator()); \
+            auto member_it = ajson.object_range().begin(); \
             if (num_params == num_mandatory_params2) \
             { \
                 JSONCONS_VARIADIC_FOR_EACH(JSONCONS_ALL_MEMBER_NAME_AS,,,, __VA_ARGS__) \
@@ -694,6 +793,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(ToJson,,,, __VA_ARGS__) \
             return ajson; \
         } \
@@ -713,12 +813,13 @@ namespace reflect { \
             using string_view_type = basic_string_view<char_type>; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
             std::error_code ec; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_MEMBER_NAME_COUNT, ,,, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(Encode, ,,, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -749,12 +850,12 @@ namespace reflect { \
   /**/
 
 #define JSONCONS_CTOR_GETTER_IS(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_IS_LAST(Prefix, P2, P3, Getter, Count)
-#define JSONCONS_CTOR_GETTER_IS_LAST(Prefix, P2, P3, Getter, Count) if ((num_params-Count) < num_mandatory_params1 && !ajson.contains(json_object_name_members<value_type>::Getter(char_type{}))) return false;
+#define JSONCONS_CTOR_GETTER_IS_LAST(Prefix, P2, P3, Getter, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params1) {if (!ajson.contains(json_object_name_members<value_type>::Getter(char_type{}))) {return false;}}
 
 #define JSONCONS_CTOR_GETTER_GET(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_GET_LAST(Prefix, P2, P3, Getter, Count)
 #define JSONCONS_CTOR_GETTER_GET_LAST(Prefix, P2, P3, Getter, Count) \
   auto _r ## Getter = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype((std::declval<value_type*>())->Getter())>::type>(aset, ajson, json_object_name_members<value_type>::Getter(char_type{})); \
-  if (!_r ## Getter && (num_params-Count) < num_mandatory_params2) {return result_type(jsoncons::unexpect, _r ## Getter.error().code(), json_object_name_members<value_type>::Getter(unexpect));}
+  JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) {if (!_r ## Getter) {return result_type(jsoncons::unexpect, _r ## Getter.error().code(), json_object_name_members<value_type>::Getter(unexpect));}}
 
 #define JSONCONS_CTOR_GETTER_AS(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count),
 #define JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count) \
@@ -762,39 +863,31 @@ namespace reflect { \
 
 #define JSONCONS_CTOR_GETTER_TO_JSON(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_TO_JSON_LAST(Prefix, P2, P3, Getter, Count)
 #define JSONCONS_CTOR_GETTER_TO_JSON_LAST(Prefix, P2, P3, Getter, Count) \
-if ((num_params-Count) < num_mandatory_params2) { \
-       ajson.try_emplace(json_object_name_members<value_type>::Getter(char_type{}),class_instance.Getter()); \
-  } \
-else { \
-  json_traits_helper<Json>::set_optional_json_member(json_object_name_members<value_type>::Getter(char_type{}),class_instance.Getter(), ajson); \
-}
+    json_traits_helper<Json>::template add_member<(num_params-Count) < num_mandatory_params2>(json_object_name_members<value_type>::Getter(char_type{}),class_instance.Getter(), ajson);
 
 #define JSONCONS_CTOR_GETTER_COUNT(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_COUNT_LAST(Prefix, P2, P3, Getter, Count)
 #define JSONCONS_CTOR_GETTER_COUNT_LAST(Prefix, P2, P3, Getter, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+auto&& _v ## Count = val.Getter(); \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
-} 
+    member_count += static_cast<std::size_t>(is_optional_value_set(_v ## Count)); \
+}
 
 #define JSONCONS_CTOR_GETTER_ENCODE(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count)
 #define JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
 { \
-    auto r = try_encode_member(json_object_name_members<value_type>::Getter(char_type{}), val.Getter(), encoder); \
+    auto r = try_encode_member(json_object_name_members<value_type>::Getter(char_type{}), _v ## Count, encoder); \
     if (JSONCONS_UNLIKELY(!r)) {return r;} \
 } \
 else \
 { \
-    auto r = try_encode_optional_member(json_object_name_members<value_type>::Getter(char_type{}), val.Getter(), encoder); \
+    auto r = try_encode_optional_member(json_object_name_members<value_type>::Getter(char_type{}), _v ## Count, encoder); \
     if (JSONCONS_UNLIKELY(!r)) {return r;} \
-} 
+}
 
 #define JSONCONS_CTOR_GETTER_TRAITS_BASE(NumTemplateParams, ClassName,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons { \
@@ -823,7 +916,7 @@ namespace reflect { \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, # ClassName); \
+            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, string_view(# ClassName, sizeof(# ClassName)-1)); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_GET,ClassName,,, __VA_ARGS__) \
             return result_type(jsoncons::make_obj_using_allocator<value_type>(aset.get_allocator(), JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_AS, ,,, __VA_ARGS__) )); \
         } \
@@ -831,6 +924,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_TO_JSON, ,,, __VA_ARGS__) \
             return ajson; \
         } \
@@ -849,12 +943,13 @@ namespace reflect { \
             using char_type = CharT; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
             std::error_code ec; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_COUNT, ,,, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_ENCODE, ,,, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -883,23 +978,46 @@ namespace reflect { \
     namespace jsoncons { template <> struct is_json_type_traits_declared<ClassName> : public std::true_type {}; } \
   /**/
  
+// One per-member type alias for the GET/AS expansions below, which
+// otherwise re-evaluate the same decay<decltype(...)> chain per use.
+// Read-only entries are skipped: they may repeat a getter already named
+// by a read-write entry (e.g. a "type" marker), and GET/AS never
+// instantiate for them anyway.
+#define JSONCONS_CTOR_GETTER_NAME_TYPE(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_TYPE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_LAST(P1, P2, P3, Seq, Count) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_TYPE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, Into) using _t_ ## Getter = typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type;
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_2(Getter, Name) JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, )
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_3(Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, ))
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_4(Getter, Name, Mode, Match) Mode(JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, ))
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_5(Getter, Name, Mode, Match, Into) Mode(JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, Into))
+#define JSONCONS_CTOR_GETTER_NAME_TYPE_6(Getter, Name, Mode, Match, Into, From) Mode(JSONCONS_CTOR_GETTER_NAME_TYPE_DEF(Getter, Into))
+
 #define JSONCONS_CTOR_GETTER_NAME_IS(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_IS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_CTOR_GETTER_NAME_IS_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params1 && JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_IS_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_CTOR_GETTER_NAME_IS_2(Getter, Name) !ajson.contains(Name)) return false;
+#define JSONCONS_CTOR_GETTER_NAME_IS_2(Getter, Name) JSONCONS_UNLIKELY(!ajson.contains(Name))) return false;
 #define JSONCONS_CTOR_GETTER_NAME_IS_3(Getter, Name, Mode) JSONCONS_CTOR_GETTER_NAME_IS_2(Getter, Name)
 #define JSONCONS_CTOR_GETTER_NAME_IS_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, , )
 #define JSONCONS_CTOR_GETTER_NAME_IS_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, Into, )
-#define JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>())) return false;} \
-    JSONCONS_CATCH(...) {return false;}
- 
+#define JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, Into, From) false) {} \
+    {auto _it = ajson.find(Name); \
+    if (JSONCONS_UNLIKELY(_it == ajson.object_range().end())) {return false;} \
+    auto _r = _it->value().template try_as<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>(); \
+    if (!_r || !Match(*_r)) {return false;}}
+
+// The MATCH pass validates only read-only entries: read-write entries
+// are fetched and Match-checked by the GET pass below, so validating
+// them here would look up and convert every such member twice.
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_IF_JSONCONS_RDONLY(X) X
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_IF_JSONCONS_RDWR(X)
+
 #define JSONCONS_CTOR_GETTER_NAME_MATCH(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_MATCH_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_CTOR_GETTER_NAME_MATCH_LAST(P1, P2, P3, Seq, Count) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_MATCH_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_CTOR_GETTER_NAME_MATCH_2(Getter, Name) 
-#define JSONCONS_CTOR_GETTER_NAME_MATCH_3(Getter, Name, Mode) 
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_2(Getter, Name)
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_3(Getter, Name, Mode)
 #define JSONCONS_CTOR_GETTER_NAME_MATCH_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_MATCH_6(Getter, Name, Mode, Match, , )
 #define JSONCONS_CTOR_GETTER_NAME_MATCH_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_MATCH_6(Getter, Name, Mode, Match, Into, )
-#define JSONCONS_CTOR_GETTER_NAME_MATCH_6(Getter, Name, Mode, Match, Into, From) { \
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_6(Getter, Name, Mode, Match, Into, From) JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_MATCH_IF_, Mode)(JSONCONS_CTOR_GETTER_NAME_MATCH_BODY(Getter, Name, Mode, Match, Into, From))
+#define JSONCONS_CTOR_GETTER_NAME_MATCH_BODY(Getter, Name, Mode, Match, Into, From) { \
   auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>(aset, ajson, Name); \
   if (result && !Match(* result)) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);} \
 }
@@ -914,9 +1032,9 @@ namespace reflect { \
 #define JSONCONS_CTOR_GETTER_NAME_GET_5(Getter, Name, Mode, Match, Into) Mode(JSONCONS_CTOR_GETTER_NAME_GET_7(Getter, Name, Mode, Match, Into,))
 #define JSONCONS_CTOR_GETTER_NAME_GET_6(Getter, Name, Mode, Match, Into, From) Mode(JSONCONS_CTOR_GETTER_NAME_GET_7(Getter, Name, Mode, Match, Into, From))
 #define JSONCONS_CTOR_GETTER_NAME_GET_7(Getter, Name, Mode, Match, Into, From) \
-  auto _r ## Getter = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>(aset, ajson, Name); \
-  if (!_r ## Getter && index < num_mandatory_params2) {return result_type(jsoncons::unexpect, _r ## Getter.error().code(), class_name);} \
-  if (_r ## Getter && !Match(* _r ## Getter)) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);} 
+  auto _r ## Getter = json_traits_helper<Json>::template try_get_member<_t_ ## Getter>(aset, ajson, Name); \
+  if (JSONCONS_UNLIKELY(!_r ## Getter && index < num_mandatory_params2)) {return result_type(jsoncons::unexpect, _r ## Getter.error().code(), class_name);} \
+  if (JSONCONS_UNLIKELY(_r ## Getter && !Match(* _r ## Getter))) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);}
 
 #define JSONCONS_CTOR_GETTER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_CTOR_GETTER_NAME_AS_2(Getter, Name) JSONCONS_CTOR_GETTER_NAME_AS_LAST_7(Getter, Name,,,, ) JSONCONS_COMMA
@@ -932,10 +1050,10 @@ namespace reflect { \
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_5(Getter, Name, Mode, Match, Into) Mode(JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match, Into, ))
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match, Into, From) Mode(JSONCONS_CTOR_GETTER_NAME_AS_LAST_7(Getter, Name, Mode, Match, Into, From))
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_7(Getter, Name, Mode, Match, Into, From) \
-  _r ## Getter ? From(std::move(*_r ## Getter)) : From(jsoncons::make_obj_using_allocator<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>(aset.get_allocator()))
+  _r ## Getter ? From(std::move(*_r ## Getter)) : From(jsoncons::make_obj_using_allocator<_t_ ## Getter>(aset.get_allocator()))
 
 #define JSONCONS_CTOR_GETTER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_CTOR_GETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_CTOR_GETTER_NAME_TO_JSON_2(Getter, Name) \
 { \
   ajson.try_emplace(Name,class_instance.Getter()); \
@@ -955,35 +1073,27 @@ else { \
 }
 
 #define JSONCONS_CTOR_GETTER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_CTOR_GETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_CTOR_GETTER_NAME_COUNT_2(Getter, Name) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Getter())); \
 }    
 #define JSONCONS_CTOR_GETTER_NAME_COUNT_3(Getter, Name, Mode) JSONCONS_CTOR_GETTER_NAME_COUNT_2(Getter, Name)
 #define JSONCONS_CTOR_GETTER_NAME_COUNT_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_COUNT_2(Getter, Name)
 #define JSONCONS_CTOR_GETTER_NAME_COUNT_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_COUNT_6(Getter, Name, Mode, Match, Into, )
 #define JSONCONS_CTOR_GETTER_NAME_COUNT_6(Getter, Name, Mode, Match, Into, From) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Getter())); \
 }    
 
 #define JSONCONS_CTOR_GETTER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_CTOR_GETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_CTOR_GETTER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_CTOR_GETTER_NAME_ENCODE_2(Getter, Name) \
 { \
     auto r = try_encode_member(string_view_type(Name), val.Getter(), encoder); \
@@ -1021,6 +1131,7 @@ namespace reflect { \
         constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
         constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
         constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_TYPE,,,, __VA_ARGS__)\
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_object()) return false; \
@@ -1030,8 +1141,8 @@ namespace reflect { \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            const char* class_name = # ClassName; \
-            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, # ClassName); \
+            const string_view class_name(# ClassName, sizeof(# ClassName)-1); \
+            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, class_name); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_MATCH,,,, __VA_ARGS__)\
             std::size_t index = 0; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_GET,ClassName,,, __VA_ARGS__) \
@@ -1041,6 +1152,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_TO_JSON,,,, __VA_ARGS__) \
             return ajson; \
         } \
@@ -1060,12 +1172,13 @@ namespace reflect { \
             using string_view_type = basic_string_view<char_type>; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
             std::error_code ec; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_COUNT,,,, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_CTOR_GETTER_NAME_ENCODE,,,, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -1134,63 +1247,39 @@ namespace reflect { \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_string()) return false; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
             auto rs = ajson.try_as_string_view(); \
             if (!rs) return false; \
             const string_view_type s = *rs; \
-            if (s.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            if (s.empty() && enum_name_table<value_type,char_type>::find_by_value(value_type()) == nullptr) \
             { \
                 return true; \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
-            return it != last; \
+            return enum_name_table<value_type,char_type>::find_by_name(s) != nullptr; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& /*aset*/, const Json& ajson) \
         { \
-            if (!is(ajson)) return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType); \
+            const string_view class_name(# EnumType, sizeof(# EnumType)-1); \
             auto rs = ajson.try_as_string_view(); \
-            if (!rs) return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType); \
+            if (!rs) return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name); \
             const string_view_type s = *rs; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            if (s.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_name(s); \
+            if (item != nullptr) \
             { \
-                return value_type(); \
+                return result_type(item->first); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
-            if (it == last) \
+            if (s.empty() && enum_name_table<value_type,char_type>::find_by_value(value_type()) == nullptr) \
             { \
-                if (s.empty()) \
-                { \
-                    return result_type(value_type()); \
-                } \
-                else \
-                { \
-                    return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType); \
-                } \
+                return result_type(value_type()); \
             } \
-            return result_type((*it).first); \
+            return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name); \
         } \
         template <typename Alloc,typename TempAlloc> \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, value_type class_instance) \
         { \
             static constexpr char_type empty_string[] = {0}; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            auto it = std::find_if(first, last, \
-                                   [class_instance](const mapped_type& item) -> bool \
-                                   { return item.first == class_instance; }); \
-            if (it == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_value(class_instance); \
+            if (item == nullptr) \
             { \
                 if (class_instance == value_type()) \
                 { \
@@ -1201,7 +1290,7 @@ namespace reflect { \
                     JSONCONS_THROW(conv_error(conv_errc::conversion_failed, # EnumType)); \
                 } \
             } \
-            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), (*it).second, semantic_tag::none); \
+            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), item->second, semantic_tag::none); \
         } \
     }; \
     template <> struct encode_traits<EnumType> \
@@ -1213,16 +1302,10 @@ namespace reflect { \
             basic_json_visitor<CharT>& encoder) \
         { \
             using char_type = CharT; \
-            using string_view_type = basic_string_view<char_type>; \
-            using mapped_type = std::pair<value_type,string_view_type>; \
             static const char_type empty_string[] = {0}; \
             std::error_code ec; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            auto it = std::find_if(first, last, \
-                                   [val](const mapped_type& item) -> bool \
-                                   { return item.first == val; }); \
-            if (it == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_value(val); \
+            if (item == nullptr) \
             { \
                 if (val == value_type()) \
                 { \
@@ -1235,7 +1318,7 @@ namespace reflect { \
                     return write_result{unexpect, conv_errc::conversion_failed}; \
                 } \
             } \
-            encoder.string_value((*it).second, semantic_tag::none, ser_context(), ec); \
+            encoder.string_value(item->second, semantic_tag::none, ser_context(), ec); \
             return write_result{}; \
         } \
     }; \
@@ -1248,36 +1331,22 @@ namespace reflect { \
         { \
             using char_type = CharT; \
             using string_view_type = basic_string_view<char_type>; \
-            using mapped_type = std::pair<value_type,string_view_type>; \
             std::error_code ec; \
             auto sv = cursor.current().template get<string_view_type>(ec); \
             if (ec) \
             { \
                 return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
             } \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            if (sv.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_name(sv); \
+            if (item != nullptr) \
             { \
-                return value_type(); \
+                return result_type(item->first); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == sv; }); \
-            if (it == last) \
+            if (sv.empty()) \
             { \
-                if (sv.empty()) \
-                { \
-                    return result_type(value_type()); \
-                } \
-                else \
-                { \
-                    return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
-                } \
+                return result_type(value_type()); \
             } \
-            return result_type((*it).first); \
+            return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
         } \
     }; \
 } \
@@ -1326,59 +1395,36 @@ namespace reflect { \
             auto rs = ajson.try_as_string_view(); \
             if (!rs) {return false;} \
             const string_view_type s = *rs; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            if (s.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            if (s.empty() && enum_name_table<value_type,char_type>::find_by_value(value_type()) == nullptr) \
             { \
                 return true; \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
-            return it != last; \
+            return enum_name_table<value_type,char_type>::find_by_name(s) != nullptr; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& /*aset*/, const Json& ajson) \
         { \
+            const string_view class_name(# EnumType, sizeof(# EnumType)-1); \
             auto rs = ajson.try_as_string_view(); \
-            if (!rs) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType);} \
+            if (!rs) {return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name);} \
             const string_view_type s = *rs; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            if (s.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_name(s); \
+            if (item != nullptr) \
             { \
-                return result_type(value_type()); \
+                return result_type(item->first); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
-            if (it == last) \
+            if (s.empty()) \
             { \
-                if (s.empty()) \
-                { \
-                    return result_type(value_type()); \
-                } \
-                else \
-                { \
-                    return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType); \
-                } \
+                return result_type(value_type()); \
             } \
-            return (*it).first; \
+            return result_type(jsoncons::unexpect, conv_errc::conversion_failed, class_name); \
         } \
         template <typename Alloc,typename TempAlloc> \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, value_type class_instance) \
         { \
             static constexpr char_type empty_string[] = {0}; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            auto it = std::find_if(first, last, \
-                                   [class_instance](const mapped_type& item) -> bool \
-                                   { return item.first == class_instance; }); \
-            if (it == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_value(class_instance); \
+            if (item == nullptr) \
             { \
                 if (class_instance == value_type()) \
                 { \
@@ -1389,7 +1435,7 @@ namespace reflect { \
                     JSONCONS_THROW(conv_error(conv_errc::conversion_failed, # EnumType)); \
                 } \
             } \
-            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), (*it).second, semantic_tag::none); \
+            return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), item->second, semantic_tag::none); \
         } \
     }; \
     template <> struct encode_traits<EnumType> \
@@ -1401,16 +1447,10 @@ namespace reflect { \
             basic_json_visitor<CharT>& encoder) \
         { \
             using char_type = CharT; \
-            using string_view_type = basic_string_view<char_type>; \
-            using mapped_type = std::pair<value_type,string_view_type>; \
             static const char_type empty_string[] = {0}; \
             std::error_code ec; \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            auto it = std::find_if(first, last, \
-                                   [val](const mapped_type& item) -> bool \
-                                   { return item.first == val; }); \
-            if (it == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_value(val); \
+            if (item == nullptr) \
             { \
                 if (val == value_type()) \
                 { \
@@ -1423,7 +1463,7 @@ namespace reflect { \
                     return write_result{unexpect, conv_errc::conversion_failed}; \
                 } \
             } \
-            encoder.string_value((*it).second, semantic_tag::none, ser_context(), ec); \
+            encoder.string_value(item->second, semantic_tag::none, ser_context(), ec); \
             return write_result{}; \
         } \
     }; \
@@ -1436,36 +1476,22 @@ namespace reflect { \
         { \
             using char_type = CharT; \
             using string_view_type = basic_string_view<char_type>; \
-            using mapped_type = std::pair<value_type,string_view_type>; \
             std::error_code ec; \
             auto sv = cursor.current().template get<string_view_type>(ec); \
             if (ec) \
             { \
                 return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
             } \
-            auto first = reflect_type_properties<value_type>::values<char_type>(); \
-            auto last = first + reflect_type_properties<value_type>::count; \
-            if (sv.empty() && std::find_if(first, last, \
-                                          [](const mapped_type& item) -> bool \
-                                          { return item.first == value_type(); }) == last) \
+            auto item = enum_name_table<value_type,char_type>::find_by_name(sv); \
+            if (item != nullptr) \
             { \
-                return value_type(); \
+                return result_type(item->first); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == sv; }); \
-            if (it == last) \
+            if (sv.empty()) \
             { \
-                if (sv.empty()) \
-                { \
-                    return result_type(value_type()); \
-                } \
-                else \
-                { \
-                    return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
-                } \
+                return result_type(value_type()); \
             } \
-            return result_type((*it).first); \
+            return result_type(jsoncons::unexpect, conv_errc::conversion_failed, # EnumType, cursor.line(), cursor.column()); \
         } \
     }; \
 } \
@@ -1478,7 +1504,7 @@ namespace reflect { \
 #define JSONCONS_N_GETTER_SETTER_AS_(Prefix, Getter, Setter, Property, Count) { \
   auto result = json_traits_helper<Json>::template try_get_member<typename std::decay<decltype(class_instance.Getter())>::type>(aset, ajson, json_object_name_members<value_type>::Property(char_type{})); \
   if (result) {class_instance.Setter(std::move(* result));} \
-  else if ((num_params-Count) < num_mandatory_params2) {return result_type(jsoncons::unexpect, result.error().code(), # Prefix);} \
+  else JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) {return result_type(jsoncons::unexpect, result.error().code(), # Prefix);} \
   else if (result.error().code() != conv_errc::missing_required_member){return result_type(jsoncons::unexpect, result.error().code(), # Prefix);} \
 }
 
@@ -1493,10 +1519,7 @@ namespace reflect { \
 #define JSONCONS_N_GETTER_SETTER_TO_JSON(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_TO_JSON_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_N_GETTER_SETTER_TO_JSON_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_TO_JSON_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_N_GETTER_SETTER_TO_JSON_(Prefix, Getter, Setter, Property, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
-  {ajson.try_emplace(json_object_name_members<value_type>::Property(char_type{}),class_instance.Getter());} \
-else \
-  {json_traits_helper<Json>::set_optional_json_member(json_object_name_members<value_type>::Property(char_type{}),class_instance.Getter(), ajson);}
+    json_traits_helper<Json>::template add_member<(num_params-Count) < num_mandatory_params2>(json_object_name_members<value_type>::Property(char_type{}),class_instance.Getter(), ajson);
 
 #define JSONCONS_ALL_GETTER_SETTER_TO_JSON(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_ALL_GETTER_SETTER_TO_JSON_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_ALL_GETTER_SETTER_TO_JSON_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_ALL_GETTER_SETTER_TO_JSON_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
@@ -1505,31 +1528,28 @@ else \
 #define JSONCONS_N_GETTER_SETTER_COUNT(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_COUNT_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_N_GETTER_SETTER_COUNT_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_COUNT_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_N_GETTER_SETTER_COUNT_(Prefix, Getter, Setter, Property, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+auto&& _v ## Count = val.Getter(); \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
-} 
+    member_count += static_cast<std::size_t>(is_optional_value_set(_v ## Count)); \
+}
 
-#define JSONCONS_N_GETTER_SETTER_ENCODE(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
-#define JSONCONS_N_GETTER_SETTER_ENCODE_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
+#define JSONCONS_N_GETTER_SETTER_ENCODE(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count)
+#define JSONCONS_N_GETTER_SETTER_ENCODE_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_N_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count)
 #define JSONCONS_N_GETTER_SETTER_ENCODE_(Prefix, Getter, Setter, Property, Count) \
-if ((num_params-Count) < num_mandatory_params2) \
+JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) \
 { \
-    auto r = try_encode_member(json_object_name_members<value_type>::Property(char_type{}), val.Getter(), encoder); \
+    auto r = try_encode_member(json_object_name_members<value_type>::Property(char_type{}), _v ## Count, encoder); \
     if (JSONCONS_UNLIKELY(!r)) {return r;} \
 } \
 else \
 { \
-    auto r = try_encode_optional_member(json_object_name_members<value_type>::Property(char_type{}), val.Getter(), encoder); \
+    auto r = try_encode_optional_member(json_object_name_members<value_type>::Property(char_type{}), _v ## Count, encoder); \
     if (JSONCONS_UNLIKELY(!r)) {return r;} \
-} 
+}
 
 #define JSONCONS_GETTER_SETTER_TRAITS_BASE(ToJson,NumTemplateParams, ClassName,GetPrefix,SetPrefix,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons { \
@@ -1552,13 +1572,14 @@ namespace reflect { \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_object()) return false; \
+            auto member_it = ajson.object_range().begin(); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_MEMBER_IS, ,GetPrefix,SetPrefix, __VA_ARGS__)\
             return true; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, # ClassName); \
+            if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, string_view(# ClassName, sizeof(# ClassName)-1)); \
             value_type class_instance = jsoncons::make_obj_using_allocator<value_type>(aset.get_allocator()); \
             if (num_params == num_mandatory_params2) \
             { \
@@ -1574,6 +1595,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(ToJson, ,GetPrefix,SetPrefix, __VA_ARGS__) \
             return ajson; \
         } \
@@ -1592,12 +1614,13 @@ namespace reflect { \
             using char_type = CharT; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
             std::error_code ec; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_GETTER_SETTER_COUNT, ,GetPrefix,SetPrefix, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_GETTER_SETTER_ENCODE, ,GetPrefix,SetPrefix, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -1628,12 +1651,16 @@ namespace reflect { \
  
 #define JSONCONS_GETTER_SETTER_NAME_IS(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_IS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_GETTER_SETTER_NAME_IS_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params1 && JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_GETTER_SETTER_NAME_IS_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_GETTER_SETTER_NAME_IS_3(Getter, Setter, Name) !ajson.contains(Name)) return false;
+#define JSONCONS_GETTER_SETTER_NAME_IS_3(Getter, Setter, Name) !json_traits_helper<Json>::has_member(ajson, Name, member_it)) return false;
 #define JSONCONS_GETTER_SETTER_NAME_IS_5(Getter, Setter, Name, Mode, Match) JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match,, )
 #define JSONCONS_GETTER_SETTER_NAME_IS_6(Getter, Setter, Name, Mode, Match, Into) JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match, Into, )
-#define JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>())) return false;} \
-    JSONCONS_CATCH(...) {return false;}
+#define JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match, Into, From) false) {} \
+    {auto _it = ajson.find(Name); \
+    if (_it == ajson.object_range().end()) {return false;} \
+    member_it = _it; \
+    ++member_it; \
+    auto _r = _it->value().template try_as<typename std::decay<decltype(Into((std::declval<value_type*>())->Getter()))>::type>(); \
+    if (!_r || !Match(*_r)) {return false;}}
 
 #define JSONCONS_N_GETTER_SETTER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_GETTER_SETTER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_N_GETTER_SETTER_NAME_AS_LAST(P1, P2, P3, Seq, Count) index = num_params-Count; JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_GETTER_SETTER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
@@ -1680,7 +1707,7 @@ namespace reflect { \
   else {return result_type(jsoncons::unexpect, result.error().code(), class_name);} 
 
 #define JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_ALL_GETTER_SETTER_NAME_TO_JSON_3(Getter, Setter, Name) \
   ajson.try_emplace(Name,class_instance.Getter()); \
 else \
@@ -1693,34 +1720,26 @@ else \
   {json_traits_helper<Json>::set_optional_json_member(string_view_type(Name), Into(class_instance.Getter()), ajson);}
  
 #define JSONCONS_N_GETTER_SETTER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_N_GETTER_SETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_N_GETTER_SETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_GETTER_SETTER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_N_GETTER_SETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_GETTER_SETTER_NAME_COUNT_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_N_GETTER_SETTER_NAME_COUNT_3(Getter, Setter, Name) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Getter())); \
 }    
 #define JSONCONS_N_GETTER_SETTER_NAME_COUNT_5(Getter, Setter, Name, Mode, Match) JSONCONS_N_GETTER_SETTER_NAME_COUNT_7(Getter, Setter, Name, Mode, Match, , )
 #define JSONCONS_N_GETTER_SETTER_NAME_COUNT_6(Getter, Setter, Name, Mode, Match, Into) JSONCONS_N_GETTER_SETTER_NAME_COUNT_7(Getter, Setter, Name, Mode, Match, Into, )
 #define JSONCONS_N_GETTER_SETTER_NAME_COUNT_7(Getter, Setter, Name, Mode, Match, Into, From) \
 { \
-    ++member_count; \
 } \
 else \
 { \
-    if (is_optional_value_set(val.Getter())) \
-    { \
-        ++member_count; \
-    } \
+    member_count += static_cast<std::size_t>(is_optional_value_set(val.Getter())); \
 }    
 
 #define JSONCONS_N_GETTER_SETTER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_N_GETTER_SETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_N_GETTER_SETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_GETTER_SETTER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_N_GETTER_SETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) JSONCONS_IF_CONSTEXPR ((num_params-Count) < num_mandatory_params2) JSONCONS_PP_EXPAND(JSONCONS_PP_CONCAT(JSONCONS_N_GETTER_SETTER_NAME_ENCODE_,JSONCONS_NARGS Seq) Seq)
 #define JSONCONS_N_GETTER_SETTER_NAME_ENCODE_3(Getter, Setter, Name) \
 { \
     auto r = try_encode_member(string_view_type(Name), val.Getter(), encoder); \
@@ -1761,13 +1780,14 @@ namespace reflect { \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_object()) return false; \
+            auto member_it = ajson.object_range().begin(); \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_GETTER_SETTER_NAME_IS,,,, __VA_ARGS__)\
             return true; \
         } \
         template <typename Alloc,typename TempAlloc> \
         static result_type try_as(const allocator_set<Alloc,TempAlloc>& aset, const Json& ajson) \
         { \
-            const char* class_name = # ClassName; \
+            const string_view class_name(# ClassName, sizeof(# ClassName)-1); \
             std::error_code ec; \
             if (!ajson.is_object()) return result_type(jsoncons::unexpect, conv_errc::not_map, class_name); \
             value_type class_instance = jsoncons::make_obj_using_allocator<value_type>(aset.get_allocator()); \
@@ -1786,6 +1806,7 @@ namespace reflect { \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& class_instance) \
         { \
             Json ajson = jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), json_object_arg, semantic_tag::none); \
+            ajson.reserve(num_params); \
             JSONCONS_VARIADIC_FOR_EACH(ToJson,,,, __VA_ARGS__) \
             return ajson; \
         } \
@@ -1805,12 +1826,13 @@ namespace reflect { \
             using string_view_type = basic_string_view<char_type>; \
             (void)num_params; (void)num_mandatory_params1; (void)num_mandatory_params2; \
             std::error_code ec; \
-            std::size_t member_count{0}; \
+            const ser_context context{}; \
+            std::size_t member_count{num_mandatory_params2}; \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_GETTER_SETTER_NAME_COUNT,,,, __VA_ARGS__) \
-            encoder.begin_object(member_count, semantic_tag::none, ser_context(), ec); \
+            encoder.begin_object(member_count, semantic_tag::none, context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_N_GETTER_SETTER_NAME_ENCODE,,,, __VA_ARGS__) \
-            encoder.end_object(ser_context(), ec); \
+            encoder.end_object(context, ec); \
             if (JSONCONS_UNLIKELY(ec)) {return write_result{unexpect, ec};} \
             return write_result{}; \
         } \
@@ -1875,6 +1897,9 @@ namespace reflect { \
 #define JSONCONS_POLYMORPHIC_TO_JSON(BaseClass, P2, P3, DerivedClass, Count) if (DerivedClass* p = dynamic_cast<DerivedClass*>(ptr.get())) {return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *p);}
 #define JSONCONS_POLYMORPHIC_TO_JSON_LAST(BaseClass, P2, P3, DerivedClass, Count) if (DerivedClass* p = dynamic_cast<DerivedClass*>(ptr.get())) {return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *p);}
 
+#define JSONCONS_POLYMORPHIC_TO_JSON_EXACT(BaseClass, P2, P3, DerivedClass, Count) if (ti == typeid(DerivedClass)) {return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *dynamic_cast<DerivedClass*>(ptr.get()));}
+#define JSONCONS_POLYMORPHIC_TO_JSON_EXACT_LAST(BaseClass, P2, P3, DerivedClass, Count) if (ti == typeid(DerivedClass)) {return jsoncons::make_obj_using_allocator<Json>(aset.get_allocator(), *dynamic_cast<DerivedClass*>(ptr.get()));}
+
 #define JSONCONS_POLYMORPHIC_TRAITS(BaseClass, ...)  \
 namespace jsoncons { \
 namespace reflect { \
@@ -1898,6 +1923,8 @@ namespace reflect { \
         template <typename Alloc,typename TempAlloc> \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& ptr) { \
             if (ptr.get() == nullptr) {return Json::null();} \
+            const std::type_info& ti = typeid(*ptr); \
+            JSONCONS_VARIADIC_FOR_EACH(JSONCONS_POLYMORPHIC_TO_JSON_EXACT, BaseClass,,, __VA_ARGS__)\
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_POLYMORPHIC_TO_JSON, BaseClass,,, __VA_ARGS__)\
             return Json::null(); \
         } \
@@ -1920,6 +1947,8 @@ namespace reflect { \
         template <typename Alloc,typename TempAlloc> \
         static Json to_json(const allocator_set<Alloc,TempAlloc>& aset, const value_type& ptr) { \
             if (ptr.get() == nullptr) {return Json::null();} \
+            const std::type_info& ti = typeid(*ptr); \
+            JSONCONS_VARIADIC_FOR_EACH(JSONCONS_POLYMORPHIC_TO_JSON_EXACT, BaseClass,,, __VA_ARGS__)\
             JSONCONS_VARIADIC_FOR_EACH(JSONCONS_POLYMORPHIC_TO_JSON, BaseClass,,, __VA_ARGS__)\
             return Json::null(); \
         } \
@@ -273,8 +273,27 @@ namespace detail {
     typename std::enable_if<ext_traits::is_back_insertable_byte_container<Container>::value,to_bytes_result<InputIt>>::type 
     base16_to_bytes(InputIt first, InputIt last, Container& result)
     {
+        static constexpr uint8_t reverse_alphabet[256] = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 10,   11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 10,   11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+        };
+
         std::size_t len = std::distance(first,last);
-        if (len & 1) 
+        if (len & 1)
         {
             return to_bytes_result<InputIt>{first, conv_errc::not_base16};
         }
@@ -282,36 +301,16 @@ namespace detail {
         InputIt it = first;
         while (it != last)
         {
-            uint8_t val;
             auto a = *it++;
-            if (a >= '0' && a <= '9') 
-            {
-                val = static_cast<uint8_t>(a - '0') << 4;
-            } 
-            else if ((a | 0x20) >= 'a' && (a | 0x20) <= 'f') 
-            {
-                val = (static_cast<uint8_t>((a | 0x20) - 'a') + 10) << 4;
-            } 
-            else 
-            {
-                return to_bytes_result<InputIt>{first, conv_errc::not_base16};
-            }
-
             auto b = *it++;
-            if (b >= '0' && b <= '9') 
-            {
-                val |= (b - '0');
-            } 
-            else if ((b | 0x20) >= 'a' && (b | 0x20) <= 'f') 
-            {
-                val |= ((b | 0x20) - 'a' + 10);
-            } 
-            else 
+            const uint8_t hi = (static_cast<unsigned long long>(a) < 256) ? reverse_alphabet[static_cast<uint8_t>(a)] : static_cast<uint8_t>(0xff);
+            const uint8_t lo = (static_cast<unsigned long long>(b) < 256) ? reverse_alphabet[static_cast<uint8_t>(b)] : static_cast<uint8_t>(0xff);
+            if ((hi | lo) > 0x0f)
             {
                 return to_bytes_result<InputIt>{first, conv_errc::not_base16};
             }
 
-            result.push_back(val);
+            result.push_back(static_cast<uint8_t>((hi << 4) | lo));
         }
         return to_bytes_result<InputIt>{last, conv_errc::success};
     }
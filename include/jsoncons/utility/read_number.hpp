@@ -10,6 +10,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <cstring> // std::memcpy
 #include <locale>
 #include <stdexcept>
 #include <string>
@@ -160,59 +161,63 @@ struct to_number_result
 enum class integer_chars_format : uint8_t {decimal=1,hex};
 enum class integer_chars_state {initial,minus,integer,binary,octal,decimal,base16};
 
-template <typename CharT>
-bool is_base10(const CharT* s, std::size_t length)
+// Returns true if [s,s+length) consists entirely of decimal digits.
+// The char overload checks eight bytes per iteration: subtracting '0'
+// sets the high bit of any byte below '0', adding 0x46 sets the high
+// bit of any byte above '9', and all-digit words produce neither
+// carries nor borrows between bytes.
+inline bool all_digits(const char* s, std::size_t length) noexcept
 {
-    integer_chars_state state = integer_chars_state::initial;
+    while (length >= 8)
+    {
+        uint64_t w;
+        std::memcpy(&w, s, 8);
+        const uint64_t x = w - UINT64_C(0x3030303030303030);
+        const uint64_t y = w + UINT64_C(0x4646464646464646);
+        if (((x | y) & UINT64_C(0x8080808080808080)) != 0)
+        {
+            return false;
+        }
+        s += 8;
+        length -= 8;
+    }
+    for (; length > 0; ++s, --length)
+    {
+        if (!is_digit(*s))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-    const CharT* end = s + length; 
-    for (;s < end; ++s)
+template <typename CharT>
+bool all_digits(const CharT* s, std::size_t length) noexcept
+{
+    const CharT* end = s + length;
+    for (; s < end; ++s)
     {
-        switch(state)
+        if (!is_digit(*s))
         {
-            case integer_chars_state::initial:
-            {
-                switch(*s)
-                {
-                    case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                        state = integer_chars_state::decimal;
-                        break;
-                    case '-':
-                        state = integer_chars_state::minus;
-                        break;
-                    default:
-                        return false;
-                }
-                break;
-            }
-            case integer_chars_state::minus:
-            {
-                switch(*s)
-                {
-                    case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                        state = integer_chars_state::decimal;
-                        break;
-                    default:
-                        return false;
-                }
-                break;
-            }
-            case integer_chars_state::decimal:
-            {
-                switch(*s)
-                {
-                    case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                        break;
-                    default:
-                        return false;
-                }
-                break;
-            }
-            default:
-                break;
+            return false;
         }
     }
-    return state == integer_chars_state::decimal ? true : false;
+    return true;
+}
+
+template <typename CharT>
+bool is_base10(const CharT* s, std::size_t length)
+{
+    const CharT* end = s + length;
+    if (s < end && *s == '-')
+    {
+        ++s;
+    }
+    if (s == end)
+    {
+        return false;
+    }
+    return all_digits(s, static_cast<std::size_t>(end - s));
 }
 
 template <typename T,typename CharT>
@@ -1134,8 +1134,24 @@ namespace unicode_traits {
     {
         conv_errc  result = conv_errc();
         const CharT* last = data + length;
-        while (data != last) 
+        while (data != last)
         {
+            // Fast path: an 8 byte block with no high bit set is a run of
+            // single byte sequences, all of which are legal UTF-8.
+            while ((std::size_t)(last - data) >= 8)
+            {
+                uint64_t w;
+                std::memcpy(&w, data, 8);
+                if ((w & 0x8080808080808080ULL) != 0)
+                {
+                    break;
+                }
+                data += 8;
+            }
+            if (data == last)
+            {
+                break;
+            }
             std::size_t len = static_cast<std::size_t>(trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
             if (len > (std::size_t)(last - data))
             {
@@ -138,6 +138,7 @@ private:
     std::size_t column_index_{0};
     string_type value_buffer_;
     typename column_path_column_map_type::iterator column_it_;
+    std::vector<string_type*> column_value_slots_;
 
     // Noncopyable and nonmoveable
     basic_csv_encoder(const basic_csv_encoder&) = delete;
@@ -219,6 +220,7 @@ public:
             column_paths_.clear();
             column_path_value_map_.clear();
         }
+        column_value_slots_.clear();
         column_index_ = 0;
     }
 
@@ -230,6 +232,25 @@ public:
 
 private:
 
+    // Maps each entry of column_paths_ to its slot in column_path_value_map_
+    // once, instead of re-running a hash lookup per column for every row.
+    // The map is node-based so the cached pointers stay valid while entries
+    // are added; the cache is rebuilt whenever a new column path appears.
+    const std::vector<string_type*>& column_value_slots()
+    {
+        if (column_value_slots_.size() != column_paths_.size())
+        {
+            column_value_slots_.clear();
+            column_value_slots_.reserve(column_paths_.size());
+            for (const auto& path : column_paths_)
+            {
+                auto it = column_path_value_map_.find(path);
+                column_value_slots_.push_back(it != column_path_value_map_.end() ? &(*it).second : nullptr);
+            }
+        }
+        return column_value_slots_;
+    }
+
     void escape_string(const CharT* s,
                        std::size_t length,
                        CharT quote_char, CharT quote_escape_char,
@@ -239,16 +260,23 @@ private:
         const CharT* end = s + length;
         for (const CharT* it = begin; it != end; ++it)
         {
-            CharT c = *it;
-            if (c == quote_char)
+            // Append the run up to the next quote character in one piece
+            // rather than a character at a time.
+            const CharT* span = it;
+            while (it != end && *it != quote_char)
             {
-                sink.push_back(quote_escape_char); 
-                sink.push_back(quote_char);
+                ++it;
             }
-            else
+            if (it != span)
             {
-                sink.push_back(c);
+                sink.append(span, static_cast<std::size_t>(it - span));
             }
+            if (it == end)
+            {
+                break;
+            }
+            sink.push_back(quote_escape_char);
+            sink.push_back(quote_char);
         }
     }
 
@@ -367,17 +395,17 @@ private:
                         }
                         sink_.append(line_delimiter_.data(), line_delimiter_.length());
                     }
-                    for (std::size_t i = 0; i < column_paths_.size(); ++i)
+                    const auto& slots = column_value_slots();
+                    for (std::size_t i = 0; i < slots.size(); ++i)
                     {
                         if (i > 0)
                         {
                             sink_.push_back(field_delimiter_);
                         }
-                        auto it = column_path_value_map_.find(column_paths_[i]);
-                        if (it != column_path_value_map_.end())
+                        if (slots[i] != nullptr)
                         {
-                            sink_.append(it->second.data(), it->second.length());
-                            it->second.clear();
+                            sink_.append(slots[i]->data(), slots[i]->length());
+                            slots[i]->clear();
                         }
                     }
                     sink_.append(line_delimiter_.data(), line_delimiter_.length());
@@ -649,17 +677,17 @@ private:
                         sink_.append(line_delimiter_.data(), line_delimiter_.length());
                     }
 
-                    for (std::size_t i = 0; i < column_paths_.size(); ++i)
+                    const auto& slots = column_value_slots();
+                    for (std::size_t i = 0; i < slots.size(); ++i)
                     {
                         if (i > 0)
                         {
                             sink_.push_back(field_delimiter_);
                         }
-                        auto it = column_path_value_map_.find(column_paths_[i]);
-                        if (it != column_path_value_map_.end())
+                        if (slots[i] != nullptr)
                         {
-                            sink_.append(it->second.data(), it->second.length());
-                            it->second.clear();
+                            sink_.append(slots[i]->data(), slots[i]->length());
+                            slots[i]->clear();
                         }
                     }
                     sink_.append(line_delimiter_.data(), line_delimiter_.length());
@@ -712,17 +740,17 @@ private:
                             line_delimiter_.length());
                     }
                     
-                    for (std::size_t i = 0; i < column_paths_.size(); ++i)
+                    const auto& slots = column_value_slots();
+                    for (std::size_t i = 0; i < slots.size(); ++i)
                     {
                         if (i > 0)
                         {
                             sink_.push_back(field_delimiter_);
                         }
-                        auto it = column_path_value_map_.find(column_paths_[i]);
-                        if (it != column_path_value_map_.end())
+                        if (slots[i] != nullptr)
                         {
-                            sink_.append(it->second.data(), it->second.length());
-                            it->second.clear();
+                            sink_.append(slots[i]->data(), slots[i]->length());
+                            slots[i]->clear();
                         }
                     }
                     sink_.append(line_delimiter_.data(), line_delimiter_.length());
@@ -1309,15 +1337,31 @@ private:
 
     void write_string_value(const string_view_type& value, string_type& str)
     {
-        const char* s = value.data();
+        const CharT* s = value.data();
         const std::size_t length = value.length();
-        
+
         bool quote = false;
-        if (quote_style_ == quote_style_kind::all || quote_style_ == quote_style_kind::nonnumeric ||
-            (quote_style_ == quote_style_kind::minimal &&
-            (std::char_traits<CharT>::find(s, length, field_delimiter_) != nullptr || std::char_traits<CharT>::find(s, length, quote_char_) != nullptr)))
+        if (quote_style_ == quote_style_kind::all || quote_style_ == quote_style_kind::nonnumeric)
+        {
+            quote = true;
+        }
+        else if (quote_style_ == quote_style_kind::minimal)
         {
+            const CharT* last = s + length;
+            const CharT* p = s;
+            while (p != last && *p != field_delimiter_ && *p != quote_char_)
+            {
+                ++p;
+            }
+            if (p == last)
+            {
+                str.append(s, length);
+                return;
+            }
             quote = true;
+        }
+        if (quote)
+        {
             str.push_back(quote_char_);
         }
         escape_string(s, length, quote_char_, quote_escape_char_, str);
@@ -12,7 +12,6 @@
 #include <cstdint>
 #include <functional>
 #include <memory> // std::allocator
-#include <sstream>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -226,6 +225,14 @@ namespace detail {
         }
     };
 
+    enum class packed_column_kind : uint8_t
+    {
+        none,          // no cells seen yet
+        double_value,  // all cells so far are plain doubles
+        int64_value,   // all cells so far are plain int64s
+        events         // mixed content, held as parse events
+    };
+
     template <typename CharT,typename TempAlloc >
     class m_columns_filter : public basic_json_visitor<CharT>
     {
@@ -241,6 +248,13 @@ namespace detail {
         using parse_event_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_event<CharT,TempAlloc>>;
         using parse_event_vector_type = std::vector<parse_event<CharT,TempAlloc>, parse_event_allocator_type>;
         using parse_event_vector_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_event_vector_type>;
+        using double_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<double>;
+        using double_vector_type = std::vector<double,double_allocator_type>;
+        using double_vector_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<double_vector_type>;
+        using int64_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<int64_t>;
+        using int64_vector_type = std::vector<int64_t,int64_allocator_type>;
+        using int64_vector_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<int64_vector_type>;
+        using packed_kind_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<packed_column_kind>;
     private:
         TempAlloc alloc_;
         std::size_t name_index_{0};
@@ -252,12 +266,22 @@ namespace detail {
 
         std::vector<string_type, string_allocator_type> column_names_;
         std::vector<parse_event_vector_type,parse_event_vector_allocator_type> cached_events_;
+
+        // Packed (structure-of-arrays) storage for homogeneous numeric columns.
+        // A column stays packed while every cell is a plain double or int64;
+        // the first cell of any other kind spills the column into cached_events_.
+        std::vector<packed_column_kind,packed_kind_allocator_type> column_kinds_;
+        std::vector<double_vector_type,double_vector_allocator_type> packed_doubles_;
+        std::vector<int64_vector_type,int64_vector_allocator_type> packed_int64s_;
     public:
 
         m_columns_filter(const TempAlloc& alloc)
             : alloc_(alloc),
               column_names_(alloc),
-              cached_events_(alloc)
+              cached_events_(alloc),
+              column_kinds_(alloc),
+              packed_doubles_(alloc),
+              packed_int64s_(alloc)
         {
         }
 
@@ -271,6 +295,9 @@ namespace detail {
             row_index_ = 0;
             column_names_.clear();
             cached_events_.clear();
+            column_kinds_.clear();
+            packed_doubles_.clear();
+            packed_int64s_.clear();
         }
 
         bool done() const
@@ -280,10 +307,18 @@ namespace detail {
 
         void initialize(const std::vector<string_type, string_allocator_type>& column_names)
         {
+            column_names_.reserve(column_names.size());
+            cached_events_.reserve(column_names.size());
+            column_kinds_.reserve(column_names.size());
+            packed_doubles_.reserve(column_names.size());
+            packed_int64s_.reserve(column_names.size());
             for (const auto& name : column_names)
             {
                 column_names_.push_back(name);
                 cached_events_.emplace_back(alloc_);
+                column_kinds_.push_back(packed_column_kind::none);
+                packed_doubles_.emplace_back(alloc_);
+                packed_int64s_.emplace_back(alloc_);
             }
             name_index_ = 0;
             level_ = 0;
@@ -303,6 +338,64 @@ namespace detail {
             return static_cast<int>(level_);
         }
 
+        std::size_t cell_count(std::size_t index) const
+        {
+            switch (column_kinds_[index])
+            {
+                case packed_column_kind::double_value:
+                    return packed_doubles_[index].size();
+                case packed_column_kind::int64_value:
+                    return packed_int64s_[index].size();
+                default:
+                    return cached_events_[index].size();
+            }
+        }
+
+        void replay_cell(basic_json_visitor<CharT>& visitor, std::size_t index, std::size_t row) const
+        {
+            switch (column_kinds_[index])
+            {
+                case packed_column_kind::double_value:
+                    visitor.double_value(packed_doubles_[index][row], semantic_tag::none, ser_context());
+                    break;
+                case packed_column_kind::int64_value:
+                    visitor.int64_value(packed_int64s_[index][row], semantic_tag::none, ser_context());
+                    break;
+                default:
+                    cached_events_[index][row].replay(visitor);
+                    break;
+            }
+        }
+
+        // Converts a packed column to parse events so that a cell of a
+        // different kind can be appended, and returns the event vector.
+        parse_event_vector_type& spill(std::size_t index)
+        {
+            switch (column_kinds_[index])
+            {
+                case packed_column_kind::double_value:
+                    cached_events_[index].reserve(packed_doubles_[index].size());
+                    for (double val : packed_doubles_[index])
+                    {
+                        cached_events_[index].emplace_back(val, semantic_tag::none, alloc_);
+                    }
+                    packed_doubles_[index].clear();
+                    break;
+                case packed_column_kind::int64_value:
+                    cached_events_[index].reserve(packed_int64s_[index].size());
+                    for (int64_t val : packed_int64s_[index])
+                    {
+                        cached_events_[index].emplace_back(val, semantic_tag::none, alloc_);
+                    }
+                    packed_int64s_[index].clear();
+                    break;
+                default:
+                    break;
+            }
+            column_kinds_[index] = packed_column_kind::events;
+            return cached_events_[index];
+        }
+
         bool replay_parse_events(basic_json_visitor<CharT>& visitor, bool cursor_mode, int mark_level)
         {
             bool more = true;
@@ -358,9 +451,9 @@ namespace detail {
                         state_ = cached_state::name;
                         break;
                     case cached_state::item:
-                        if (row_index_ < cached_events_[column_index_].size())
+                        if (row_index_ < cell_count(column_index_))
                         {
-                            cached_events_[column_index_][row_index_].replay(visitor);
+                            replay_cell(visitor, column_index_, row_index_);
                             more = !cursor_mode;
                             ++row_index_;
                         }
@@ -397,8 +490,8 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(staj_event_type::begin_array, tag, alloc_);
-                
+                spill(name_index_).emplace_back(staj_event_type::begin_array, tag, alloc_);
+
                 ++level2_;
             }
             JSONCONS_VISITOR_RETURN;
@@ -408,7 +501,7 @@ namespace detail {
         {
             if (level2_ > 0)
             {
-                cached_events_[name_index_].emplace_back(staj_event_type::end_array, semantic_tag::none, alloc_);
+                spill(name_index_).emplace_back(staj_event_type::end_array, semantic_tag::none, alloc_);
                 ++name_index_;
                 --level2_;
             }
@@ -429,7 +522,7 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(staj_event_type::null_value, tag, alloc_);
+                spill(name_index_).emplace_back(staj_event_type::null_value, tag, alloc_);
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -442,7 +535,7 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                spill(name_index_).emplace_back(value, tag, alloc_);
 
                 if (level2_ == 0)
                 {
@@ -459,7 +552,7 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                spill(name_index_).emplace_back(value, tag, alloc_);
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -469,13 +562,23 @@ namespace detail {
         }
 
         JSONCONS_VISITOR_RETURN_TYPE visit_double(double value,
-                             semantic_tag tag, 
+                             semantic_tag tag,
                              const ser_context&,
                              std::error_code&) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (level2_ == 0 && tag == semantic_tag::none &&
+                    (column_kinds_[name_index_] == packed_column_kind::none ||
+                     column_kinds_[name_index_] == packed_column_kind::double_value))
+                {
+                    column_kinds_[name_index_] = packed_column_kind::double_value;
+                    packed_doubles_[name_index_].push_back(value);
+                }
+                else
+                {
+                    spill(name_index_).emplace_back(value, tag, alloc_);
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -491,7 +594,17 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (level2_ == 0 && tag == semantic_tag::none &&
+                    (column_kinds_[name_index_] == packed_column_kind::none ||
+                     column_kinds_[name_index_] == packed_column_kind::int64_value))
+                {
+                    column_kinds_[name_index_] = packed_column_kind::int64_value;
+                    packed_int64s_[name_index_].push_back(value);
+                }
+                else
+                {
+                    spill(name_index_).emplace_back(value, tag, alloc_);
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -507,7 +620,7 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                spill(name_index_).emplace_back(value, tag, alloc_);
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -520,7 +633,7 @@ namespace detail {
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                spill(name_index_).emplace_back(value, tag, alloc_);
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -607,6 +720,7 @@ private:
     std::vector<csv_parse_state,csv_parse_state_allocator_type> state_stack_;
     string_type buffer_;
     std::vector<std::pair<std::basic_string<char_type>,double>> string_double_map_;
+    std::vector<std::pair<std::basic_string<char_type>,double>> column_value_cache_;
 
 public:
     basic_csv_parser(const TempAlloc& alloc = TempAlloc())
@@ -1014,23 +1128,28 @@ public:
                         state_ = csv_parse_state::expect_record;
                     }
                     break;
-                case csv_parse_state::quoted_string: 
+                case csv_parse_state::quoted_string:
                     {
                         if (curr_char == quote_escape_char_)
                         {
                             state_ = csv_parse_state::escaped_value;
+                            ++column_;
+                            ++input_ptr_;
                         }
                         else if (curr_char == quote_char_)
                         {
                             state_ = csv_parse_state::between_values;
+                            ++column_;
+                            ++input_ptr_;
                         }
                         else
                         {
-                            buffer_.push_back(static_cast<CharT>(curr_char));
+                            const CharT* run_end = scan_quoted(input_ptr_+1, local_input_end);
+                            buffer_.append(input_ptr_, static_cast<std::size_t>(run_end - input_ptr_));
+                            column_ += static_cast<std::size_t>(run_end - input_ptr_);
+                            input_ptr_ = run_end;
                         }
                     }
-                    ++column_;
-                    ++input_ptr_;
                     break;
                 case csv_parse_state::escaped_value: 
                     {
@@ -1293,9 +1412,10 @@ public:
                             }
                             else
                             {
-                                buffer_.push_back(static_cast<CharT>(curr_char));
-                                ++column_;
-                                ++input_ptr_;
+                                const CharT* run_end = scan_unquoted(input_ptr_+1, local_input_end);
+                                buffer_.append(input_ptr_, static_cast<std::size_t>(run_end - input_ptr_));
+                                column_ += static_cast<std::size_t>(run_end - input_ptr_);
+                                input_ptr_ = run_end;
                             }
                             break;
                     }
@@ -1464,6 +1584,64 @@ private:
         stack_.push_back((header_lines_ > 0) ? csv_mode::header : csv_mode::data);
     }
 
+    // Scans forward from p over characters that have no significance in an
+    // unquoted field, returning a pointer to the first character (delimiter,
+    // subfield delimiter, quote or line ending) that the state machine needs
+    // to look at. Lets the parser consume ordinary field characters a run at
+    // a time rather than one switch dispatch per character.
+    const CharT* scan_unquoted(const CharT* p, const CharT* last) const
+    {
+        while (p != last)
+        {
+            CharT c = *p;
+            if (c == '\n' || c == '\r' || c == field_delimiter_ || c == quote_char_ ||
+                (subfield_delimiter_ != char_type() && c == subfield_delimiter_))
+            {
+                break;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+    // Columns such as dates, rates and category codes commonly repeat the
+    // same text from row to row. Remember the most recent text-to-double
+    // conversion per column so that a repeated field skips re-conversion.
+    // The mapping from text to value is input-independent, so entries never
+    // need to be invalidated.
+    bool find_cached_double(std::size_t col, double& d) const
+    {
+        if (col < column_value_cache_.size() &&
+            column_value_cache_[col].first.length() == buffer_.length() &&
+            std::char_traits<CharT>::compare(column_value_cache_[col].first.data(), buffer_.data(), buffer_.length()) == 0)
+        {
+            d = column_value_cache_[col].second;
+            return true;
+        }
+        return false;
+    }
+
+    void cache_double(std::size_t col, double d)
+    {
+        if (col >= column_value_cache_.size())
+        {
+            column_value_cache_.resize(col+1);
+        }
+        column_value_cache_[col].first.assign(buffer_.data(), buffer_.length());
+        column_value_cache_[col].second = d;
+    }
+
+    // The quoted-string analog of scan_unquoted: only the quote character
+    // and the quote escape character end a run inside a quoted field.
+    const CharT* scan_quoted(const CharT* p, const CharT* last) const
+    {
+        while (p != last && *p != quote_char_ && *p != quote_escape_char_)
+        {
+            ++p;
+        }
+        return p;
+    }
+
     // name
     void before_value(basic_json_visitor<CharT>& visitor, 
         std::error_code& ec)
@@ -1881,10 +2059,9 @@ private:
             {
                 case csv_column_type::integer_t:
                     {
-                        std::basic_istringstream<CharT,std::char_traits<CharT>,char_allocator_type> iss{buffer_};
-                        int64_t val;
-                        iss >> val;
-                        if (!iss.fail())
+                        int64_t val = 0;
+                        auto result = jsoncons::utility::dec_to_integer(buffer_.data(), buffer_.length(), val);
+                        if (result)
                         {
                             visitor.int64_value(val, semantic_tag::none, *this, ec);
                             more_ = !cursor_mode_;
@@ -1915,11 +2092,18 @@ private:
                         }
                         else
                         {
-                            std::basic_istringstream<CharT, std::char_traits<CharT>, char_allocator_type> iss{ buffer_ };
-                            double val;
-                            iss >> val;
-                            if (!iss.fail())
+                            double cached_val{0};
+                            if (find_cached_double(column_index_ - offset_, cached_val))
+                            {
+                                visitor.double_value(cached_val, semantic_tag::none, *this, ec);
+                                more_ = !cursor_mode_;
+                                break;
+                            }
+                            double val = 0;
+                            auto result = jsoncons::utility::decstr_to_double(buffer_.data(), buffer_.length(), val);
+                            if (result)
                             {
+                                cache_double(column_index_ - offset_, val);
                                 visitor.double_value(val, semantic_tag::none, *this, ec);
                                 more_ = !cursor_mode_;
                             }
@@ -2047,7 +2231,8 @@ private:
 
         auto last = buffer_.end();
 
-        std::string buffer;
+        // Pure classification scan - conversion below reads buffer_ directly,
+        // so no cleaned per-field copy is built.
         for (auto p = buffer_.begin(); state != numeric_check_state::not_a_number && p != last; ++p)
         {
             switch (state)
@@ -2088,17 +2273,14 @@ private:
                         break;
                     case '-':
                         is_negative = true;
-                        buffer.push_back(*p);
                         state = numeric_check_state::minus;
                         break;
                     case '0':
                         //++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         //++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -2113,12 +2295,10 @@ private:
                     {
                         case '.':
                         {
-                            buffer.push_back('.');
                             state = numeric_check_state::fraction1;
                         }
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -2133,14 +2313,11 @@ private:
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         //++precision;
-                        buffer.push_back(*p);
                         break;
                     case '.':
-                        buffer.push_back('.');
                         state = numeric_check_state::fraction1;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -2155,12 +2332,10 @@ private:
                     {
                     case '0':
                         //++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         //++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -2176,7 +2351,6 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         //++precision;
                         //++decimal_places;
-                        buffer.push_back(*p);
                         state = numeric_check_state::fraction;
                         break;
                     default:
@@ -2192,10 +2366,8 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         //++precision;
                         //++decimal_places;
-                        buffer.push_back(*p);
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -2209,13 +2381,11 @@ private:
                     switch (*p)
                     {
                     case '-':
-                        buffer.push_back(*p);
                         break;
                     case '+':
                         break;
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         state = numeric_check_state::exp;
-                        buffer.push_back(*p);
                         break;
                     default:
                         state = numeric_check_state::not_a_number;
@@ -2228,7 +2398,6 @@ private:
                     switch (*p)
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
-                        buffer.push_back(*p);
                         break;
                     default:
                         state = numeric_check_state::not_a_number;
@@ -2307,16 +2476,20 @@ private:
                 else
                 {
                     double d{0};
-                    auto result = jsoncons::utility::decstr_to_double(buffer.c_str(), buffer.length(), d);
-                    if (result.ec == std::errc::result_out_of_range)
+                    if (!find_cached_double(column_index_, d))
                     {
-                        d = buffer.front() == '-' ? -HUGE_VAL : HUGE_VAL;
-                    }
-                    else if (result.ec == std::errc::invalid_argument)
-                    {
-                        ec = csv_errc::invalid_number; 
-                        more_ = false;
-                        return;
+                        auto result = jsoncons::utility::decstr_to_double(buffer_.data(), buffer_.length(), d);
+                        if (result.ec == std::errc::result_out_of_range)
+                        {
+                            d = buffer_.front() == '-' ? -HUGE_VAL : HUGE_VAL;
+                        }
+                        else if (result.ec == std::errc::invalid_argument)
+                        {
+                            ec = csv_errc::invalid_number;
+                            more_ = false;
+                            return;
+                        }
+                        cache_double(column_index_, d);
                     }
                     visitor.double_value(d, semantic_tag::none, *this, ec);
                     more_ = !cursor_mode_;